@@ -24,7 +24,9 @@
 
 #include "list.h"
 #include "cib.h"
+#include "irq.h"
 #include "msg.h"
+#include "thread.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,7 +34,7 @@ extern "C" {
 
 /** Static initializer for mbox objects */
 #define MBOX_INIT(queue, queue_size) { \
-        { 0 }, { 0 }, CIB_INIT(queue_size), queue \
+        .cib = CIB_INIT(queue_size), .msg_array = queue \
 }
 
 /**
@@ -43,6 +45,10 @@ typedef struct {
     list_node_t writers;    /**< list of threads waiting to send        */
     cib_t cib;              /**< cib for msg array                      */
     msg_t *msg_array;       /**< ptr to array of msg queue              */
+#if defined(MODULE_CORE_MBOX_NOTIFY) || defined(DOXYGEN)
+    thread_t *notify;       /**< thread notified of queued messages     */
+    thread_flags_t notify_flags; /**< thread flags set on @ref notify   */
+#endif
 } mbox_t;
 
 enum {
@@ -185,6 +191,33 @@ static inline size_t mbox_avail(mbox_t *mbox)
     return cib_avail(&mbox->cib);
 }
 
+#if defined(MODULE_CORE_MBOX_NOTIFY) || defined(DOXYGEN)
+/**
+ * @brief Set the thread to notify when a message is queued
+ *
+ * Whenever a message is put into the queue of @p mbox, @p flags are set on
+ * @p thread with @ref thread_flags_set(). Messages handed directly to a
+ * thread blocked in @ref mbox_get() cause no notification. Only one thread
+ * can be notified per mailbox.
+ *
+ * @note    Only available with module `core_mbox_notify`, which requires
+ *          `core_thread_flags`.
+ *
+ * @param[in] mbox      ptr to mailbox to operate on
+ * @param[in] thread    thread to notify, NULL to disable notifications
+ * @param[in] flags     thread flags to set on @p thread
+ */
+static inline void mbox_set_notify(mbox_t *mbox, thread_t *thread,
+                                   thread_flags_t flags)
+{
+    unsigned irqstate = irq_disable();
+
+    mbox->notify = thread;
+    mbox->notify_flags = flags;
+    irq_restore(irqstate);
+}
+#endif
+
 /**
  * @brief   Unset's the mbox, effectively deinitializing and invalidating it.
  *
@@ -281,6 +281,31 @@ int msg_send_to_self(msg_t *m);
  */
 int msg_send_int(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send multiple messages to a thread at once (non-blocking).
+ *
+ * All messages are delivered within a single critical section and at most one
+ * context switch is triggered afterwards. This is considerably cheaper than
+ * calling @ref msg_try_send() for each message when a thread needs to hand a
+ * burst of messages to another thread.
+ *
+ * If the target is waiting in @ref msg_receive() (or
+ * @ref msg_receive_batch()), the first message is copied directly, the
+ * remaining messages are put into the target's message queue in order.
+ * Delivery stops at the first message that does not fit into the queue. This
+ * function never blocks and may be called from interrupt context, in which
+ * case `msg_t::sender_pid` is set to @ref KERNEL_PID_ISR.
+ *
+ * @param[in] m             Array of @p num preallocated ``msg_t`` structures,
+ *                          must not be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages delivered (in order, starting with `m[0]`)
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Test if the message was sent inside an ISR.
  * @see msg_send_int()
@@ -318,6 +343,24 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages at once.
+ *
+ * This function blocks until at least one message was received. It then takes
+ * up to @p num messages from the thread's message queue and from threads
+ * blocked in @ref msg_send() on the calling thread in a single critical
+ * section. All senders unblocked by this call cause at most one context
+ * switch.
+ *
+ * @param[out] m    Array of @p num preallocated ``msg_t`` structures, must not
+ *                  be NULL.
+ * @param[in] num   Maximum number of messages to receive, must be > 0.
+ *
+ * @return  number of messages received (1 ... @p num), stored in order
+ *          starting at `m[0]`
+ */
+int msg_receive_batch(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
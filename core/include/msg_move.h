@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_msg_move  Messaging with buffer ownership transfer
+ * @ingroup     core_msg
+ * @brief       Zero-copy message payloads that move between threads
+ *
+ * A @ref msg_t can only carry a pointer or a 32-bit value. Larger payloads
+ * are usually passed by pointer, which requires an out-of-band agreement on
+ * who frees the buffer. This module provides fixed-size buffer pools whose
+ * buffers are *owned* by exactly one thread at a time. Sending a buffer with
+ * @ref msg_move_send() passes the ownership to the receiving thread along with
+ * the message, so the payload is never copied.
+ *
+ * Buffers are returned to their pool automatically
+ *
+ * - if they cannot be delivered because the target does not exist or, for
+ *   @ref msg_move_try_send(), because its message queue is full, and
+ * - if the owning thread exits, including buffers that are still waiting in
+ *   the message queue of that thread.
+ *
+ * The pool memory must be provided by the user, see @ref MSG_MOVE_POOL_SIZE.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static uint64_t _pool_mem[MSG_MOVE_POOL_SIZE(64, 4) / sizeof(uint64_t)];
+ * static msg_move_pool_t _pool;
+ *
+ * msg_move_pool_init(&_pool, _pool_mem, 64, 4);
+ *
+ * uint8_t *buf = msg_move_alloc(&_pool);
+ * msg_t m = { .type = MY_DATA_TYPE };
+ * // fill buf ...
+ * msg_move_send(&m, target_pid, buf);   // buf now belongs to target_pid
+ *
+ * // on the receiving side:
+ * msg_receive(&m);
+ * // use m.content.ptr, then
+ * msg_move_free(m.content.ptr);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Messaging with buffer ownership transfer API
+ */
+
+#ifndef MSG_MOVE_H
+#define MSG_MOVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Alignment of the buffers handed out by a pool
+ */
+#define MSG_MOVE_ALIGN              (8U)
+
+/**
+ * @brief   Forward declaration of the pool type
+ */
+typedef struct msg_move_pool msg_move_pool_t;
+
+/**
+ * @brief   Management header in front of each buffer
+ *
+ * @internal
+ */
+typedef struct msg_move_hdr {
+    struct msg_move_hdr *next;  /**< next free buffer (while unused) */
+    msg_move_pool_t *pool;      /**< pool the buffer belongs to */
+    kernel_pid_t owner;         /**< owning thread, @ref KERNEL_PID_UNDEF if
+                                 *   free, @ref KERNEL_PID_ISR if allocated
+                                 *   from interrupt context */
+} msg_move_hdr_t;
+
+/**
+ * @brief   Size of the management header rounded up to @ref MSG_MOVE_ALIGN
+ */
+#define MSG_MOVE_HDR_SIZE \
+    ((sizeof(msg_move_hdr_t) + MSG_MOVE_ALIGN - 1) & ~(MSG_MOVE_ALIGN - 1))
+
+/**
+ * @brief   Memory occupied by a single buffer of @p size bytes in a pool
+ */
+#define MSG_MOVE_BUF_STRIDE(size) \
+    (MSG_MOVE_HDR_SIZE + (((size) + MSG_MOVE_ALIGN - 1) & ~(MSG_MOVE_ALIGN - 1)))
+
+/**
+ * @brief   Memory required for a pool of @p num buffers of @p size bytes
+ */
+#define MSG_MOVE_POOL_SIZE(size, num)   ((num) * MSG_MOVE_BUF_STRIDE(size))
+
+/**
+ * @brief   Buffer pool for messages with ownership transfer
+ *
+ * @note    All fields are private, use the functions of this module
+ */
+struct msg_move_pool {
+    msg_move_pool_t *next;      /**< next registered pool */
+    msg_move_hdr_t *free;       /**< list of free buffers */
+    uint8_t *mem;               /**< pool memory */
+    size_t stride;              /**< distance between two buffers in @ref mem */
+    size_t buf_size;            /**< usable size of each buffer */
+    unsigned num;               /**< number of buffers in the pool */
+    unsigned avail;             /**< number of free buffers in the pool */
+};
+
+/**
+ * @brief   Initialize a buffer pool
+ *
+ * @pre     @p mem is aligned to @ref MSG_MOVE_ALIGN
+ *
+ * @param[out] pool     The pool to initialize
+ * @param[in] mem       Memory for the pool of at least
+ *                      `MSG_MOVE_POOL_SIZE(buf_size, num)` bytes
+ * @param[in] buf_size  Usable size of each buffer in bytes
+ * @param[in] num       Number of buffers in the pool
+ */
+void msg_move_pool_init(msg_move_pool_t *pool, void *mem, size_t buf_size,
+                        unsigned num);
+
+/**
+ * @brief   Get the number of free buffers in a pool
+ *
+ * @param[in] pool  A pool
+ *
+ * @return  Number of buffers that can currently be allocated from @p pool
+ */
+static inline unsigned msg_move_pool_avail(const msg_move_pool_t *pool)
+{
+    return pool->avail;
+}
+
+/**
+ * @brief   Allocate a buffer from a pool
+ *
+ * The calling thread becomes the owner of the buffer. Buffers allocated in
+ * interrupt context have no owner until they are sent to a thread.
+ *
+ * @param[in] pool  The pool to allocate from
+ *
+ * @return  Buffer of `msg_move_pool_t::buf_size` bytes
+ * @return  NULL, if the pool is exhausted
+ */
+void *msg_move_alloc(msg_move_pool_t *pool);
+
+/**
+ * @brief   Return a buffer to its pool
+ *
+ * @param[in] buf   A buffer obtained by @ref msg_move_alloc() or received
+ *                  with a message. May be NULL.
+ */
+void msg_move_free(void *buf);
+
+/**
+ * @brief   Get the thread owning a buffer
+ *
+ * @param[in] buf   A buffer obtained by @ref msg_move_alloc()
+ *
+ * @return  PID of the owner
+ * @return  @ref KERNEL_PID_ISR, if the buffer was allocated in interrupt
+ *          context and not sent to a thread yet
+ */
+kernel_pid_t msg_move_owner(const void *buf);
+
+/**
+ * @brief   Send a buffer along with a message (blocking)
+ *
+ * Sets `m->content.ptr` to @p buf and transfers the ownership of @p buf to
+ * @p target_pid. The buffer must not be accessed by the caller afterwards.
+ * Behaves like @ref msg_send() otherwise.
+ *
+ * @param[in] m             Pointer to preallocated ``msg_t`` structure, must
+ *                          not be NULL.
+ * @param[in] target_pid    PID of target thread
+ * @param[in] buf           Buffer owned by the caller, must not be NULL
+ *
+ * @return  1, if sending was successful
+ * @return  0, if called from ISR and the receiver cannot receive the message
+ *          now. @p buf is freed.
+ * @return  -1, on error (invalid PID). @p buf is freed.
+ */
+int msg_move_send(msg_t *m, kernel_pid_t target_pid, void *buf);
+
+/**
+ * @brief   Send a buffer along with a message (non-blocking)
+ *
+ * Same as @ref msg_move_send() but behaves like @ref msg_try_send().
+ *
+ * @param[in] m             Pointer to preallocated ``msg_t`` structure, must
+ *                          not be NULL.
+ * @param[in] target_pid    PID of target thread
+ * @param[in] buf           Buffer owned by the caller, must not be NULL
+ *
+ * @return  1, if sending was successful
+ * @return  0, if the receiver is not waiting or has a full message queue.
+ *          @p buf is freed.
+ * @return  -1, on error (invalid PID). @p buf is freed.
+ */
+int msg_move_try_send(msg_t *m, kernel_pid_t target_pid, void *buf);
+
+/**
+ * @brief   Free all buffers owned by a thread
+ *
+ * @internal Called by the scheduler when a thread exits.
+ *
+ * @param[in] pid   PID of the exiting thread
+ */
+void msg_move_release_owned(kernel_pid_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSG_MOVE_H */
+/** @} */
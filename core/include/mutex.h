@@ -18,6 +18,27 @@
  *              module `core_mutex_priority_inheritance` to employ
  *              priority inheritance as mitigation.
  *
+ * Priority Inheritance
+ * ====================
+ *
+ * With module `core_mutex_priority_inheritance`, a thread blocking on a mutex
+ * raises the priority of the owner to its own priority if the owner has a
+ * lower priority. If the owner is itself blocked on another mutex, the boost
+ * is passed on to the owner of that mutex and so on. A thread may hold
+ * several mutexes at a time and release them in any order: on every unlock by
+ * a boosted thread, its priority is recomputed from its base priority and the
+ * highest priority thread still blocked on a mutex it holds. Only the mutexes
+ * a thread holds that other threads are waiting for are visited for this. The worst-case
+ * blocking time of a high priority thread is thus bounded by the critical
+ * sections of lower priority threads holding the mutexes it needs.
+ *
+ * @note    Priority inheritance only works for mutexes locked by a thread.
+ *          Mutexes initialized as locked (@ref MUTEX_INIT_LOCKED) have no
+ *          owner until they are passed on by @ref mutex_unlock.
+ * @note    Changing the priority of a thread via @ref sched_change_priority
+ *          while it holds a mutex is not supported in combination with
+ *          priority inheritance.
+ *
  * Mutex Implementation Basics
  * ===========================
  *
@@ -163,6 +184,17 @@ typedef struct {
      */
     kernel_pid_t owner;
 #endif
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    /**
+     * @brief   Entry in the list of contended mutexes of the owner
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     *
+     * Only valid while threads are waiting for the mutex.
+     */
+    list_node_t pi_node;
+#endif
 #if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_DEBUG)
     /**
      * @brief   Program counter of the call to @ref mutex_lock that most
@@ -173,14 +205,6 @@ typedef struct {
      */
     uinttxtptr_t owner_calling_pc;
 #endif
-#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    /**
-     * @brief   Original priority of the owner
-     * @note    Only available if module core_mutex_priority_inheritance
-     *          is used.
-     */
-    uint8_t owner_original_priority;
-#endif
 } mutex_t;
 
 /**
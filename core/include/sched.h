@@ -345,6 +345,28 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if (IS_USED(MODULE_SCHED_SWITCH_CALLBACK)) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler context switch callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          In contrast to the callback of @ref sched_register_cb() it is
+ *          linked in directly, so it costs no more than a function call.
+ *          It will be called with interrupts disabled:
+ *          - when the scheduler switches to another thread,
+ *          - when the CPU goes to sleep without an idle thread and
+ *          - when the CPU wakes up again without an idle thread
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   next      the thread scheduled next, or @ref KERNEL_PID_UNDEF if
+ *                    the CPU goes to sleep without an idle thread
+ */
+extern void sched_switch_callback(kernel_pid_t next);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
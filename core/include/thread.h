@@ -179,9 +179,16 @@ struct _thread {
     clist_node_t rq_entry;          /**< run queue entry                */
 
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
-    || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
-    void *wait_data;                /**< used by msg, mbox and thread
-                                         flags                          */
+    || defined(MODULE_CORE_MBOX) \
+    || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    void *wait_data;                /**< used by msg, mbox, thread flags
+                                         and mutex priority inheritance */
+#endif
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< priority without boost by mutex
+                                         priority inheritance           */
+    list_node_t pi_held;            /**< held mutexes other threads are
+                                         waiting for                    */
 #endif
 #if defined(MODULE_CORE_MSG) || defined(DOXYGEN)
     list_node_t msg_waiters;        /**< threads waiting for their message
@@ -193,13 +200,14 @@ struct _thread {
                                          to this thread's message queue */
 #endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
-    || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
+    || defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_STACK_WATERMARK) \
+    || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
 #endif
 #if defined(CONFIG_THREAD_NAMES) || defined(DOXYGEN)
     const char *name;               /**< thread's name                  */
 #endif
-#if defined(DEVELHELP) || defined(DOXYGEN)
+#if defined(DEVELHELP) || defined(MODULE_STACK_WATERMARK) || defined(DOXYGEN)
     int stack_size;                 /**< thread's stack size            */
 #endif
 /* enable TLS only when Picolibc is compiled with TLS enabled */
@@ -279,6 +287,24 @@ kernel_pid_t thread_create(char *stack,
                            void *arg,
                            const char *name);
 
+#if (IS_USED(MODULE_THREAD_CREATE_CALLBACK)) || defined(DOXYGEN)
+/**
+ * @brief   Thread creation callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It will be called by @ref thread_create() with interrupts
+ *          disabled, before the new thread is scheduled for the first time.
+ *          This allows to reset per-thread data when a PID is reused.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   pid       PID of the newly created thread
+ */
+extern void thread_create_callback(kernel_pid_t pid);
+#endif
+
 /**
  * @brief       Retrieve a thread control block by PID.
  * @pre         @p pid is valid
@@ -571,7 +597,7 @@ const char *thread_state_to_string(thread_status_t state);
 static inline void *thread_get_stackstart(const thread_t *thread)
 {
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
-    || defined(MODULE_MPU_STACK_GUARD)
+    || defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_STACK_WATERMARK)
     return thread->stack_start;
 #else
     (void)thread;
@@ -600,7 +626,7 @@ static inline void *thread_get_sp(const thread_t *thread)
  */
 static inline size_t thread_get_stacksize(const thread_t *thread)
 {
-#if defined(DEVELHELP)
+#if defined(DEVELHELP) || defined(MODULE_STACK_WATERMARK)
     return thread->stack_size;
 #else
     (void)thread;
@@ -643,6 +669,10 @@ static inline const char *thread_get_name(const thread_t *thread)
  * @pre         Does not work if the thread was created with the flag
  *              `THREAD_CREATE_NO_STACKTEST`.
  *
+ * @note        With module `stack_watermark`, stacks are painted lazily and
+ *              the result is only meaningful once the thread's stack has been
+ *              painted. Use @ref stack_watermark_headroom() instead.
+ *
  * @param[in] thread    The thread to measure the stack of
  *
  * @return              the amount of unused space of the thread's stack
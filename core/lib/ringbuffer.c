@@ -56,15 +56,29 @@ static char get_head(ringbuffer_t *restrict rb)
 
 unsigned ringbuffer_add(ringbuffer_t *restrict rb, const char *buf, unsigned n)
 {
-    unsigned i;
+    unsigned free = rb->size - rb->avail;
 
-    for (i = 0; i < n; i++) {
-        if (ringbuffer_full(rb)) {
-            break;
+    if (n > free) {
+        n = free;
+    }
+    if (n > 0) {
+        unsigned pos = rb->start + rb->avail;
+
+        if (pos >= rb->size) {
+            pos -= rb->size;
         }
-        add_tail(rb, buf[i]);
+
+        unsigned bytes_till_end = rb->size - pos;
+        if (bytes_till_end >= n) {
+            memcpy(rb->buf + pos, buf, n);
+        }
+        else {
+            memcpy(rb->buf + pos, buf, bytes_till_end);
+            memcpy(rb->buf, buf + bytes_till_end, n - bytes_till_end);
+        }
+        rb->avail += n;
     }
-    return i;
+    return n;
 }
 
 int ringbuffer_add_one(ringbuffer_t *restrict rb, char c)
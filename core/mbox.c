@@ -25,6 +25,10 @@
 #include "sched.h"
 #include "thread.h"
 
+#ifdef MODULE_CORE_MBOX_NOTIFY
+#include "thread_flags.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -89,7 +93,16 @@ int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
         msg->sender_pid = thread_getpid();
         /* copy msg into queue */
         mbox->msg_array[cib_put_unsafe(&mbox->cib)] = *msg;
+#ifdef MODULE_CORE_MBOX_NOTIFY
+        thread_t *notify = mbox->notify;
+        thread_flags_t flags = mbox->notify_flags;
+        irq_restore(irqstate);
+        if (notify) {
+            thread_flags_set(notify, flags);
+        }
+#else
         irq_restore(irqstate);
+#endif
         return 1;
     }
 }
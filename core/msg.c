@@ -242,6 +242,65 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     return res;
 }
 
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    uint16_t target_prio = THREAD_PRIORITY_IDLE;
+    unsigned i = 0;
+
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("%s: target_pid is invalid, continuing anyways\n", __func__);
+    }
+#endif /* DEVELHELP */
+
+    unsigned state = irq_disable();
+
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+
+        /* the receiver is waiting, so its queue is empty: hand over the first
+         * message directly and queue the remainder behind it */
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        target_prio = target->priority;
+        i = 1;
+    }
+
+    for (; i < num; i++) {
+        m[i].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[i])) {
+            break;
+        }
+    }
+
+    irq_restore(state);
+
+    DEBUG("%s: %u of %u messages delivered to %" PRIkernel_pid "\n",
+          __func__, i, num, target_pid);
+
+    if (target_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(target_prio);
+    }
+    else if (IS_USED(MODULE_CORE_THREAD_FLAGS) && sched_context_switch_request
+             && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return i;
+}
+
 int msg_send_bus(msg_t *m, msg_bus_t *bus)
 {
     const bool in_irq = irq_is_in();
@@ -442,6 +501,83 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_batch(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = 0;
+
+    DEBUG("%s: %" PRIkernel_pid ": receiving up to %u messages.\n",
+          __func__, me->pid, num);
+
+    /* queued messages are older than the ones of blocked senders, so drain
+     * the queue first */
+    if (thread_has_msg_queue(me)) {
+        int queue_index;
+
+        while ((n < num) && ((queue_index = cib_get(&me->msg_queue)) >= 0)) {
+            m[n++] = me->msg_array[queue_index];
+        }
+    }
+
+    list_node_t *next;
+
+    while ((next = me->msg_waiters.next) != NULL) {
+        thread_t *sender = container_of((clist_node_t *)next, thread_t,
+                                        rq_entry);
+        msg_t *dest;
+
+        if (n < num) {
+            dest = &m[n++];
+        }
+        else {
+            /* keep the invariant that senders only block on a full queue by
+             * moving their messages into the just freed queue space */
+            int queue_index = thread_has_msg_queue(me)
+                              ? cib_put(&me->msg_queue) : -1;
+            if (queue_index < 0) {
+                break;
+            }
+            dest = &me->msg_array[queue_index];
+        }
+
+        list_remove_head(&me->msg_waiters);
+        *dest = *((msg_t *)sender->wait_data);
+
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    if (n == 0) {
+        DEBUG("%s: %" PRIkernel_pid ": No msg available. Going blocked.\n",
+              __func__, me->pid);
+        me->wait_data = (void *)m;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+        return 1;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return n;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_msg_move
+ * @{
+ *
+ * @file
+ * @brief       Messaging with buffer ownership transfer implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "msg_move.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* all initialized pools, searched for buffers of exiting threads */
+static msg_move_pool_t *_pools;
+
+static inline msg_move_hdr_t *_hdr(const void *buf)
+{
+    return (msg_move_hdr_t *)((uint8_t *)buf - MSG_MOVE_HDR_SIZE);
+}
+
+static inline void *_buf(msg_move_hdr_t *hdr)
+{
+    return (uint8_t *)hdr + MSG_MOVE_HDR_SIZE;
+}
+
+static void _free(msg_move_hdr_t *hdr)
+{
+    msg_move_pool_t *pool = hdr->pool;
+
+    assert(hdr->owner != KERNEL_PID_UNDEF);
+    hdr->owner = KERNEL_PID_UNDEF;
+    hdr->next = pool->free;
+    pool->free = hdr;
+    pool->avail++;
+}
+
+void msg_move_pool_init(msg_move_pool_t *pool, void *mem, size_t buf_size,
+                        unsigned num)
+{
+    assert(((uintptr_t)mem % MSG_MOVE_ALIGN) == 0);
+
+    pool->mem = mem;
+    pool->buf_size = buf_size;
+    pool->stride = MSG_MOVE_BUF_STRIDE(buf_size);
+    pool->num = num;
+    pool->avail = num;
+    pool->free = NULL;
+
+    /* build the free list back to front so buffers are handed out in
+     * ascending order */
+    for (unsigned i = num; i > 0; i--) {
+        msg_move_hdr_t *hdr = (msg_move_hdr_t *)&pool->mem[(i - 1) *
+                                                           pool->stride];
+
+        hdr->pool = pool;
+        hdr->owner = KERNEL_PID_UNDEF;
+        hdr->next = pool->free;
+        pool->free = hdr;
+    }
+
+    unsigned state = irq_disable();
+
+    pool->next = _pools;
+    _pools = pool;
+    irq_restore(state);
+}
+
+void *msg_move_alloc(msg_move_pool_t *pool)
+{
+    unsigned state = irq_disable();
+    msg_move_hdr_t *hdr = pool->free;
+
+    if (hdr == NULL) {
+        irq_restore(state);
+        DEBUG("msg_move_alloc(): pool %p exhausted\n", (void *)pool);
+        return NULL;
+    }
+
+    pool->free = hdr->next;
+    pool->avail--;
+    hdr->next = NULL;
+    hdr->owner = irq_is_in() ? KERNEL_PID_ISR : thread_getpid();
+    irq_restore(state);
+
+    return _buf(hdr);
+}
+
+void msg_move_free(void *buf)
+{
+    if (buf == NULL) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+
+    _free(_hdr(buf));
+    irq_restore(state);
+}
+
+kernel_pid_t msg_move_owner(const void *buf)
+{
+    return _hdr(buf)->owner;
+}
+
+static int _move_send(msg_t *m, kernel_pid_t target_pid, void *buf,
+                      int (*send)(msg_t *, kernel_pid_t))
+{
+    msg_move_hdr_t *hdr = _hdr(buf);
+    int res;
+
+    /* only the owner may pass a buffer on */
+    assert(irq_is_in() || (hdr->owner == thread_getpid())
+           || (hdr->owner == KERNEL_PID_ISR));
+
+    /* the target may dequeue the message as soon as it is delivered, so the
+     * ownership has to be passed beforehand */
+    hdr->owner = target_pid;
+    m->content.ptr = buf;
+    res = send(m, target_pid);
+    if (res <= 0) {
+        DEBUG("msg_move: delivery to %" PRIkernel_pid " failed, freeing %p\n",
+              target_pid, buf);
+        msg_move_free(buf);
+    }
+
+    return res;
+}
+
+int msg_move_send(msg_t *m, kernel_pid_t target_pid, void *buf)
+{
+    return _move_send(m, target_pid, buf, msg_send);
+}
+
+int msg_move_try_send(msg_t *m, kernel_pid_t target_pid, void *buf)
+{
+    return _move_send(m, target_pid, buf, msg_try_send);
+}
+
+void msg_move_release_owned(kernel_pid_t pid)
+{
+    unsigned state = irq_disable();
+
+    for (msg_move_pool_t *pool = _pools; pool; pool = pool->next) {
+        for (unsigned i = 0; i < pool->num; i++) {
+            msg_move_hdr_t *hdr = (msg_move_hdr_t *)&pool->mem[i *
+                                                               pool->stride];
+
+            if (hdr->owner == pid) {
+                DEBUG("msg_move: releasing buffer %p of exiting thread %"
+                      PRIkernel_pid "\n", _buf(hdr), pid);
+                _free(hdr);
+            }
+        }
+    }
+    irq_restore(state);
+}
@@ -36,6 +36,135 @@
 
 #if MAXTHREADS > 1
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/* Priority inheritance bookkeeping. All functions must be called with IRQs
+ * disabled.
+ *
+ * A boosted thread gets the highest priority of all threads blocked on a
+ * mutex it owns, but at least its base priority. Every thread keeps a list
+ * (thread_t::pi_held) of the mutexes it owns that have waiters. As the wait
+ * queue of a mutex is sorted by priority, only the head of the queue of
+ * each of these mutexes needs to be looked at. */
+
+static bool _pi_contended(const mutex_t *mutex)
+{
+    return (mutex->queue.next != NULL) && (mutex->queue.next != MUTEX_LOCKED);
+}
+
+static uint8_t _pi_priority(const thread_t *thread)
+{
+    uint8_t prio = thread->base_priority;
+
+    for (list_node_t *node = thread->pi_held.next; node; node = node->next) {
+        mutex_t *mutex = container_of(node, mutex_t, pi_node);
+        thread_t *waiter = container_of((clist_node_t *)mutex->queue.next,
+                                        thread_t, rq_entry);
+
+        if (waiter->priority < prio) {
+            prio = waiter->priority;
+        }
+    }
+    return prio;
+}
+
+static void _pi_set_priority(thread_t *thread, uint8_t prio)
+{
+    DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid ": %u --> %u\n",
+          thread_getpid(), thread->pid, (unsigned)thread->priority,
+          (unsigned)prio);
+
+    /* a boost must not change the priority the thread falls back to */
+    uint8_t base = thread->base_priority;
+
+    sched_change_priority(thread, prio);
+    thread->base_priority = base;
+}
+
+/* Recompute the priority of thread. If it changes and thread is itself
+ * blocked on a mutex, the change is passed on along the chain of owners, so
+ * this applies and undoes boosts alike. The chain is bounded by the number of
+ * threads, so a deadlock cannot make this loop. */
+static void _pi_update(thread_t *thread)
+{
+    for (unsigned depth = 0; thread && (depth < MAXTHREADS); depth++) {
+        uint8_t prio = _pi_priority(thread);
+
+        if (thread->priority == prio) {
+            return;
+        }
+
+        if (thread->status != STATUS_MUTEX_BLOCKED) {
+            _pi_set_priority(thread, prio);
+            return;
+        }
+
+        /* keep the wait queue of the mutex the thread is blocked on sorted */
+        mutex_t *mutex = thread->wait_data;
+
+        list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+        _pi_set_priority(thread, prio);
+        thread_add_to_list(&mutex->queue, thread);
+        thread = thread_get(mutex->owner);
+    }
+}
+
+static void _pi_acquired(mutex_t *mutex, thread_t *thread)
+{
+    mutex->owner = thread->pid;
+    if (_pi_contended(mutex)) {
+        list_add(&thread->pi_held, &mutex->pi_node);
+    }
+}
+
+/* must be called before the first waiter is taken from the queue */
+static void _pi_released(mutex_t *mutex, bool contended)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    if (owner && contended) {
+        list_remove(&owner->pi_held, &mutex->pi_node);
+        _pi_update(owner);
+    }
+}
+
+static void _pi_waiter_added(mutex_t *mutex, bool first)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if (owner) {
+        if (first) {
+            list_add(&owner->pi_held, &mutex->pi_node);
+        }
+        _pi_update(owner);
+    }
+}
+
+static void _pi_waiter_removed(mutex_t *mutex)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if (owner) {
+        if (!_pi_contended(mutex)) {
+            list_remove(&owner->pi_held, &mutex->pi_node);
+        }
+        _pi_update(owner);
+    }
+}
+#else
+static inline void _pi_acquired(mutex_t *mutex, thread_t *thread)
+{
+    (void)mutex;
+    (void)thread;
+}
+
+static inline void _pi_released(mutex_t *mutex, bool contended)
+{
+    (void)mutex;
+    (void)contended;
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -68,7 +197,8 @@ void _block(mutex_t *mutex,
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
-    if (mutex->queue.next == MUTEX_LOCKED) {
+    bool first = (mutex->queue.next == MUTEX_LOCKED);
+    if (first) {
         mutex->queue.next = (list_node_t *)&me->rq_entry;
         mutex->queue.next->next = NULL;
     }
@@ -76,15 +206,11 @@ void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    me->wait_data = mutex;
+    _pi_waiter_added(mutex, first);
+#else
+    (void)first;
 #endif
 
     irq_restore(irq_state);
@@ -109,17 +235,11 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
-        || IS_USED(MODULE_CORE_MUTEX_DEBUG)
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-#endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
+        mutex->owner = thread_getpid();
         mutex->owner_calling_pc = pc;
 #endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
-#endif
+        _pi_acquired(mutex, thread_get_active());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -158,17 +278,11 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
-        || IS_USED(MODULE_CORE_MUTEX_DEBUG)
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-#endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
+        mutex->owner = thread_getpid();
         mutex->owner_calling_pc = pc;
 #endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
-#endif
+        _pi_acquired(mutex, thread_get_active());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -200,10 +314,14 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        _pi_released(mutex, false);
         irq_restore(irqstate);
         return;
     }
 
+    /* ownership is passed on to the first waiter */
+    _pi_released(mutex, true);
+
     list_node_t *next = list_remove_head(&mutex->queue);
 
     thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
@@ -216,15 +334,7 @@ void mutex_unlock(mutex_t *mutex)
         mutex->queue.next = MUTEX_LOCKED;
     }
 
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid, (unsigned)owner->priority,
-              (unsigned)mutex->owner_original_priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
-#endif
+    _pi_acquired(mutex, process);
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
 #endif
@@ -242,8 +352,10 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+            _pi_released(mutex, false);
         }
         else {
+            _pi_released(mutex, true);
             list_node_t *next = list_remove_head(&mutex->queue);
             thread_t *process = container_of((clist_node_t *)next, thread_t,
                                              rq_entry);
@@ -253,6 +365,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _pi_acquired(mutex, process);
         }
     }
 
@@ -287,6 +400,11 @@ void mutex_cancel(mutex_cancel_t *mc)
             mutex->queue.next = MUTEX_LOCKED;
         }
         sched_set_status(thread, STATUS_PENDING);
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* the owner, and whoever it waits for, may have been boosted on
+         * behalf of the cancelled thread */
+        _pi_waiter_removed(mutex);
+#endif
         irq_restore(irq_state);
         sched_switch(thread->priority);
         return;
@@ -36,6 +36,10 @@
 #include "mpu.h"
 #endif
 
+#ifdef MODULE_CORE_MSG_MOVE
+#include "msg_move.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -153,6 +157,9 @@ thread_t *__attribute__((used)) sched_run(void)
         if (active_thread) {
             _unschedule(active_thread);
             active_thread = NULL;
+#if (IS_USED(MODULE_SCHED_SWITCH_CALLBACK))
+            sched_switch_callback(KERNEL_PID_UNDEF);
+#endif
         }
 
         do {
@@ -190,6 +197,11 @@ thread_t *__attribute__((used)) sched_run(void)
         if (sched_cb && !active_thread) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
+#endif
+#if (IS_USED(MODULE_SCHED_SWITCH_CALLBACK))
+        if (!active_thread) {
+            sched_switch_callback(next_thread->pid);
+        }
 #endif
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");
     }
@@ -201,6 +213,10 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+#if (IS_USED(MODULE_SCHED_SWITCH_CALLBACK))
+        sched_switch_callback(next_thread->pid);
+#endif
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -316,6 +332,11 @@ NORETURN void sched_task_exit(void)
 #endif
 
     (void)irq_disable();
+#ifdef MODULE_CORE_MSG_MOVE
+    /* return buffers still owned by this thread (or queued for it), with
+     * IRQs off no further buffer can be moved to it afterwards */
+    msg_move_release_owned(thread_getpid());
+#endif
     sched_threads[thread_getpid()] = NULL;
     sched_num_threads--;
 
@@ -347,6 +368,9 @@ void sched_change_priority(thread_t *thread, uint8_t priority)
         _runqueue_push(thread, priority);
     }
     thread->priority = priority;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+#endif
 
     irq_restore(irq_state);
 
@@ -264,8 +264,10 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 #endif
 
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
-    || defined(MODULE_TEST_UTILS_PRINT_STACK_USAGE)
-    if (flags & THREAD_CREATE_NO_STACKTEST) {
+    || defined(MODULE_TEST_UTILS_PRINT_STACK_USAGE) \
+    || defined(MODULE_STACK_WATERMARK)
+    /* module stack_watermark paints the stack lazily after creation */
+    if (IS_USED(MODULE_STACK_WATERMARK) || (flags & THREAD_CREATE_NO_STACKTEST)) {
         /* create stack guard. Alignment has been handled above, so silence
          * -Wcast-align */
         *(uintptr_t *)(uintptr_t)stack = (uintptr_t)stack;
@@ -306,11 +308,12 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     thread->sp = thread_stack_init(function, arg, stack, stacksize);
 
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) || \
-    defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_CORTEXM_STACK_LIMIT)
+    defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_CORTEXM_STACK_LIMIT) || \
+    defined(MODULE_STACK_WATERMARK)
     thread->stack_start = stack;
 #endif
 
-#ifdef DEVELHELP
+#if defined(DEVELHELP) || defined(MODULE_STACK_WATERMARK)
     thread->stack_size = total_stacksize;
 #endif
 #ifdef CONFIG_THREAD_NAMES
@@ -322,6 +325,16 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     thread->rq_entry.next = NULL;
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->wait_data = NULL;
+    thread->base_priority = priority;
+    thread->pi_held.next = NULL;
+#endif
+
+#if (IS_USED(MODULE_THREAD_CREATE_CALLBACK))
+    thread_create_callback(pid);
+#endif
+
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
     thread->msg_waiters.next = NULL;
@@ -43,6 +43,7 @@
 #include <linux/if_ether.h>
 #endif
 
+#include "architecture.h"
 #include "native_internal.h"
 
 #include "async_read.h"
@@ -63,6 +64,7 @@
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
+static int _recv_iol(netdev_t *netdev, const iolist_t *iolist, void *info);
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
 {
@@ -180,6 +182,7 @@ static int _confirm_send(netdev_t *netdev, void *info)
 static const netdev_driver_t netdev_driver_tap = {
     .send = _send,
     .recv = _recv,
+    .recv_iol = _recv_iol,
     .init = _init,
     .isr = _isr,
     .get = _get,
@@ -188,13 +191,13 @@ static const netdev_driver_t netdev_driver_tap = {
 };
 
 /* driver implementation */
-static inline bool _is_addr_broadcast(uint8_t *addr)
+static inline bool _is_addr_broadcast(const uint8_t *addr)
 {
     return ((addr[0] == 0xff) && (addr[1] == 0xff) && (addr[2] == 0xff) &&
             (addr[3] == 0xff) && (addr[4] == 0xff) && (addr[5] == 0xff));
 }
 
-static inline bool _is_addr_multicast(uint8_t *addr)
+static inline bool _is_addr_multicast(const uint8_t *addr)
 {
     /* source: http://ieee802.org/secmail/pdfocSP2xXA6d.pdf */
     return (addr[0] & 0x01);
@@ -227,6 +230,53 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_in_syscall--;
 }
 
+/* filters a frame after it was read, returns its length or 0 if it was
+ * dropped */
+static int _handle_read(netdev_tap_t *dev, int nread, const uint8_t *dst)
+{
+    if (nread > 0) {
+        if (!(dev->promiscuous) && !_is_addr_multicast(dst) &&
+            !_is_addr_broadcast(dst) &&
+            (memcmp(dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+                  "That's not me => Dropped\n",
+                  dst[0], dst[1], dst[2], dst[3], dst[4], dst[5]);
+
+            native_async_read_continue(dev->tap_fd);
+
+            return 0;
+        }
+
+        _continue_reading(dev);
+
+        return nread;
+    }
+    else if (nread == -1) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+        }
+        else {
+            err(EXIT_FAILURE, "netdev_tap: read");
+        }
+    }
+    else if (nread == 0) {
+        DEBUG("_native_handle_tap_input: ignoring null-event\n");
+    }
+    else {
+        errx(EXIT_FAILURE, "internal error _rx_event");
+    }
+
+    return -1;
+}
+
+static int _drop_truncated(netdev_tap_t *dev, size_t len)
+{
+    DEBUG("netdev_tap: frame larger than %" PRIuSIZE " bytes dropped\n", len);
+    (void)len;
+    _continue_reading(dev);
+
+    return -ENOBUFS;
+}
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -257,43 +307,59 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
         return ETHERNET_FRAME_LEN;
     }
 
-    int nread = real_read(dev->tap_fd, buf, len);
+    /* a read from the TAP device truncates the frame silently, an extra
+     * byte tells that the frame did not fit */
+    uint8_t overflow;
+    struct iovec iov[] = {
+        { .iov_base = buf, .iov_len = len },
+        { .iov_base = &overflow, .iov_len = sizeof(overflow) },
+    };
+    int nread = real_readv(dev->tap_fd, iov, ARRAY_SIZE(iov));
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
-    if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+    if (nread > (int)len) {
+        return _drop_truncated(dev, len);
+    }
 
-            native_async_read_continue(dev->tap_fd);
+    return _handle_read(dev, nread, ((ethernet_hdr_t *)buf)->dst);
+}
 
-            return 0;
-        }
+static int _recv_iol(netdev_t *netdev, const iolist_t *iolist, void *info)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    struct iovec iov[iolist_count(iolist) + 1];
+    uint8_t dst[ETHERNET_ADDR_LEN] = { 0 };
+    uint8_t *pos = dst;
+    uint8_t overflow;
+    unsigned n;
+    (void)info;
 
-        _continue_reading(dev);
+    size_t len = iolist_to_iovec(iolist, iov, &n);
 
-        return nread;
+    /* see _recv() */
+    iov[n].iov_base = &overflow;
+    iov[n].iov_len = sizeof(overflow);
+
+    int nread = real_readv(dev->tap_fd, iov, n + 1);
+    DEBUG("netdev_tap: read %d bytes into %u buffers\n", nread, n);
+
+    if (nread > (int)len) {
+        return _drop_truncated(dev, len);
     }
-    else if (nread == -1) {
-        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-        }
-        else {
-            err(EXIT_FAILURE, "netdev_tap: read");
+
+    /* the destination address may be split over several buffers */
+    for (const iolist_t *iol = iolist; iol && (pos < dst + sizeof(dst));
+         iol = iol->iol_next) {
+        size_t part = dst + sizeof(dst) - pos;
+
+        if (part > iol->iol_len) {
+            part = iol->iol_len;
         }
-    }
-    else if (nread == 0) {
-        DEBUG("_native_handle_tap_input: ignoring null-event\n");
-    }
-    else {
-        errx(EXIT_FAILURE, "internal error _rx_event");
+        memcpy(pos, iol->iol_base, part);
+        pos += part;
     }
 
-    return -1;
+    return _handle_read(dev, nread, dst);
 }
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
@@ -28,6 +28,7 @@
 #include "async_read.h"
 #include "byteorder.h"
 #include "checksum/crc16_ccitt.h"
+#include "container.h"
 #include "native_internal.h"
 
 #include "net/ieee802154/radio.h"
@@ -490,70 +491,74 @@ static int _read(ieee802154_dev_t *dev, void *buf, size_t max_size,
     int res;
     socket_zep_t *zepdev = dev->priv;
     size_t frame_len = max_size + sizeof(zep_v2_data_hdr_t) + 2;
+    zep_v2_data_hdr_t zep;
+    uint16_t chksum;
+
+    /* receive the PSDU directly into the caller's buffer */
+    struct iovec iov[] = {
+        { .iov_base = &zep, .iov_len = sizeof(zep) },
+        { .iov_base = buf, .iov_len = max_size },
+        { .iov_base = &chksum, .iov_len = sizeof(chksum) },
+    };
+    struct msghdr msg = { .msg_iov = iov, .msg_iovlen = ARRAY_SIZE(iov) };
 
     DEBUG("socket_zep::read: reading up to %zu bytes into %p\n", max_size, buf);
 
-    if (frame_len > sizeof(zepdev->rcv_buf)) {
-        DEBUG("socket_zep::read: frame size (%zu) exceeds RX  buffer (%zu bytes)\n",
-              frame_len, sizeof(zepdev->rcv_buf));
+    if (max_size > IEEE802154_FRAME_LEN_MAX) {
+        DEBUG("socket_zep::read: frame size (%zu) exceeds maximum (%u bytes)\n",
+              max_size, IEEE802154_FRAME_LEN_MAX);
         res = -ENOBUFS;
         goto out;
     }
 
-    res = real_recv(zepdev->sock_fd, zepdev->rcv_buf, frame_len, MSG_TRUNC);
+    res = real_recvmsg(zepdev->sock_fd, &msg, MSG_TRUNC);
 
     DEBUG("socket_zep::read: got %d/%zu bytes\n", res, frame_len);
 
-    if (res <= (int)sizeof(zep_v2_data_hdr_t) || res > (int)frame_len) {
+    if (res <= (int)(sizeof(zep) + sizeof(chksum)) || res > (int)frame_len) {
         DEBUG("socket_zep::read: %s\n", strerror(errno));
         res = 0;
         goto out;
     }
 
-    zep_hdr_t *tmp = (zep_hdr_t *)zepdev->rcv_buf;
-
-    if ((tmp->preamble[0] != 'E') || (tmp->preamble[1] != 'X')) {
+    if ((zep.hdr.preamble[0] != 'E') || (zep.hdr.preamble[1] != 'X')) {
         DEBUG("socket_zep::read: invalid ZEP header\n");
         res = -EINVAL;
         goto out;
     }
 
-    if (tmp->version != 2) {
-        DEBUG("socket_zep::read: unsupported ZEP version %u\n", tmp->version);
+    if (zep.hdr.version != 2) {
+        DEBUG("socket_zep::read: unsupported ZEP version %u\n", zep.hdr.version);
         res = -EINVAL;
         goto out;
     }
 
-    switch (((zep_v2_ack_hdr_t *)tmp)->type) {
-    case ZEP_V2_TYPE_DATA: {
-        zep_v2_data_hdr_t *zep = (zep_v2_data_hdr_t *)tmp;
-
-        if (zep->chan != zepdev->chan) {
+    switch (zep.type) {
+    case ZEP_V2_TYPE_DATA:
+        if (zep.chan != zepdev->chan) {
             DEBUG("socket_zep::read: wrong channel\n");
             res = -EINVAL;
             break;
         }
 
         if (info) {
-            info->lqi = zep->lqi_val;
+            info->lqi = zep.lqi_val;
             info->rssi = -IEEE802154_RADIO_RSSI_OFFSET;
         }
 
-        if (_dst_not_me(zepdev, zep + 1)) {
+        if (_dst_not_me(zepdev, buf)) {
             DEBUG("socket_zep::read: dst not me\n");
             res = -EINVAL;
             break;
         }
 
-        _send_ack(zepdev, zep + 1);
+        _send_ack(zepdev, buf);
 
-        memcpy(buf, zep + 1, max_size);
         res = max_size;
 
         break;
-    }
     default:
-        DEBUG("socket_zep::read: unknown type %u\n", ((zep_v2_ack_hdr_t *)tmp)->type);
+        DEBUG("socket_zep::read: unknown type %u\n", zep.type);
         res = -EINVAL;
         break;
     }
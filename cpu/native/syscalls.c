@@ -102,6 +102,8 @@ int (*real_fputc)(int c, FILE *stream);
 int (*real_fgetc)(FILE *stream);
 mode_t (*real_umask)(mode_t cmask);
 ssize_t (*real_writev)(int fildes, const struct iovec *iov, int iovcnt);
+ssize_t (*real_readv)(int fildes, const struct iovec *iov, int iovcnt);
+ssize_t (*real_recvmsg)(int sockfd, struct msghdr *msg, int flags);
 ssize_t (*real_send)(int sockfd, const void *buf, size_t len, int flags);
 off_t (*real_lseek)(int fd, off_t offset, int whence);
 off_t (*real_fstat)(int fd, struct stat *statbuf);
@@ -560,6 +562,8 @@ void _native_init_syscalls(void)
     *(void **)(&real_clearerr) = dlsym(RTLD_NEXT, "clearerr");
     *(void **)(&real_umask) = dlsym(RTLD_NEXT, "umask");
     *(void **)(&real_writev) = dlsym(RTLD_NEXT, "writev");
+    *(void **)(&real_readv) = dlsym(RTLD_NEXT, "readv");
+    *(void **)(&real_recvmsg) = dlsym(RTLD_NEXT, "recvmsg");
     *(void **)(&real_send) = dlsym(RTLD_NEXT, "send");
     *(void **)(&real_fclose) = dlsym(RTLD_NEXT, "fclose");
     *(void **)(&real_fseek) = dlsym(RTLD_NEXT, "fseek");
@@ -90,7 +90,7 @@ static void _fail_frame(ethos_t *dev)
             break;
         case ETHOS_FRAME_TYPE_TEXT:
 #ifdef MODULE_ETHOS_STDIO
-            tsrb_clear(&ethos_stdio_isrpipe.tsrb);
+            spsc_rb_clear(&ethos_stdio_isrpipe.rb);
             /* signal to handler thread that frame is at an end (makes handler thread to
              * truncate frame) */
             isrpipe_write_one(&ethos_stdio_isrpipe, ETHOS_FRAME_DELIMITER);
@@ -530,6 +530,33 @@ typedef struct netdev_driver {
      */
     int (*recv)(netdev_t *dev, void *buf, size_t len, void *info);
 
+    /**
+     * @brief   Get a received frame, scattered over an IO vector list
+     *
+     * @pre     `(dev != NULL) && (iolist != NULL)`
+     *
+     * Optional, may be NULL. Behaves like @ref netdev_driver_t::recv "recv()"
+     * with `buf != NULL`, but the frame is written into the buffers of
+     * @p iolist in order. This allows the upper layer to receive headers and
+     * payload directly into separate buffers, e.g. a header on the stack and
+     * the payload in the packet buffer, instead of splitting up a flat copy
+     * of the frame afterwards. The length of the frame (or an upper bound)
+     * is still obtained with `recv(dev, NULL, 0, NULL)`.
+     *
+     * If the frame does not fit into @p iolist, the frame is dropped and the
+     * content of the buffers becomes invalid.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[out]  iolist  buffers to write into. Elements of this list may
+     *                      have iolist_t::iol_size == 0.
+     * @param[out]  info    status information for the received frame, see
+     *                      @ref netdev_driver_t::recv "recv()"
+     *
+     * @retval  -ENOBUFS    if supplied buffers are too small
+     * @return  number of bytes read
+     */
+    int (*recv_iol)(netdev_t *dev, const iolist_t *iolist, void *info);
+
     /**
      * @brief   the driver's initialization function
      *
@@ -125,6 +125,7 @@ PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_neterr
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
+PSEUDOMODULES += gnrc_netapi_train
 PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
 PSEUDOMODULES += gnrc_netif_6lo
@@ -209,6 +210,7 @@ PSEUDOMODULES += gnrc_nettype_udp
 ## @}
 
 
+PSEUDOMODULES += gnrc_pktbuf_cache
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
@@ -253,6 +255,25 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP NewReno
+## @ingroup net_gnrc_tcp
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+##
+## Limits the data in flight to the congestion window and applies the fast recovery
+## modification of NewReno (RFC 6582). Only useful with @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 1.
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @defgroup net_gnrc_tcp_recv_buf gnrc_tcp_recv_buf: Zero-copy receive for GNRC TCP
+## @ingroup net_gnrc_tcp
+## @brief  Keep received segments in the packet buffer and provide @ref gnrc_tcp_recv_buf
+##
+## Received payload is not copied into a preallocated receive buffer, so
+## @ref CONFIG_GNRC_TCP_RCV_BUFFERS does not limit the number of connections. The
+## receive window reflects the payload a connection holds in the packet buffer.
+## @{
+PSEUDOMODULES += gnrc_tcp_recv_buf
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -384,6 +405,7 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_switch_callback
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -507,6 +529,7 @@ PSEUDOMODULES += stm32mp1_eng_mode
 PSEUDOMODULES += suit_transport_%
 PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
+PSEUDOMODULES += thread_create_callback
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
 PSEUDOMODULES += usbus_urb
@@ -15,6 +15,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <string.h>
 
 #include "net/ipv4/addr.h"
 #include "net/ipv6/addr.h"
@@ -174,6 +175,53 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **ctx,
     return (ssize_t)buf->ptr->len;
 }
 
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_batch_rx_t *msgs,
+                        unsigned num, uint32_t timeout)
+{
+    unsigned i = 0;
+    ssize_t res = 0, err = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    while (i < num) {
+        sock_udp_batch_rx_t *msg = &msgs[i];
+        uint8_t *ptr = msg->data;
+        void *pkt = NULL;
+        void *ctx = NULL;
+
+        msg->len = 0;
+        msg->truncated = false;
+        /* only wait for the first datagram, take the others from the mbox */
+        while (((res = sock_udp_recv_buf_aux(sock, &pkt, &ctx, timeout,
+                                             &msg->remote, &msg->aux)) >= 0) &&
+               (ctx != NULL)) {
+            size_t cpy = msg->max_len - msg->len;
+
+            if ((size_t)res > cpy) {
+                msg->truncated = true;
+            }
+            else {
+                cpy = res;
+            }
+            memcpy(&ptr[msg->len], pkt, cpy);
+            msg->len += cpy;
+        }
+        timeout = 0;
+        if (res == -EPROTO) {
+            /* dropped a datagram, keep draining */
+            err = res;
+            continue;
+        }
+        if (res < 0) {
+            break;
+        }
+        i++;
+    }
+    if (i > 0) {
+        return i;
+    }
+    return ((res == -EAGAIN) && (err < 0)) ? err : res;
+}
+
 ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
@@ -188,6 +236,27 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_batch_tx_t *msgs,
+                        unsigned num)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    /* netconn has no interface to pass down more than one datagram */
+    for (i = 0; i < num; i++) {
+        const iolist_t snip = { NULL, (void *)msgs[i].data, msgs[i].len };
+        ssize_t res = sock_udp_sendv_aux(sock, &snip, msgs[i].remote, NULL);
+
+        if (res < 0) {
+            if (i == 0) {
+                return res;
+            }
+            break;
+        }
+    }
+    return i;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
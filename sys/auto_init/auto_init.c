@@ -65,11 +65,21 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_SCHED_CYCLES)
+extern void sched_cycles_init(void);
+AUTO_INIT(sched_cycles_init,
+          AUTO_INIT_PRIO_MOD_SCHED_CYCLES);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
           AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN);
 #endif
+#if IS_USED(MODULE_SCHED_EDF)
+extern void sched_edf_init(void);
+AUTO_INIT(sched_edf_init,
+          AUTO_INIT_PRIO_MOD_SCHED_EDF);
+#endif
 #if IS_USED(MODULE_DUMMY_THREAD)
 extern void dummy_thread_create(void);
 AUTO_INIT(dummy_thread_create,
@@ -80,6 +90,11 @@ extern void auto_init_event_thread(void);
 AUTO_INIT(auto_init_event_thread,
           AUTO_INIT_PRIO_MOD_EVENT_THREAD);
 #endif
+#if IS_USED(MODULE_STACK_WATERMARK)
+extern void stack_watermark_init(void);
+AUTO_INIT(stack_watermark_init,
+          AUTO_INIT_PRIO_MOD_STACK_WATERMARK);
+#endif
 #if IS_USED(MODULE_SYS_BUS)
 extern void auto_init_sys_bus(void);
 AUTO_INIT(auto_init_sys_bus,
@@ -59,12 +59,24 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_CYCLES
+/**
+ * @brief   cycle counter based thread accounting priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_CYCLES                 1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
  */
 #define AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN            1060
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_EDF
+/**
+ * @brief   EDF scheduling class priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_EDF                    1065
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_DUMMY_THREAD
 /**
  * @brief   dummy thread priority
@@ -77,6 +89,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_EVENT_THREAD                 1080
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_STACK_WATERMARK
+/**
+ * @brief   lazy stack watermark priority
+ */
+#define AUTO_INIT_PRIO_MOD_STACK_WATERMARK              1085
+#endif
 #ifndef AUTO_INIT_PRIO_WDT_EVENT
 /**
  * @brief   WDT event priority
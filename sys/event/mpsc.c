@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_mpsc
+ * @{
+ *
+ * @file
+ * @brief       Lock-free multi-producer event queue implementation
+ *
+ * Posted events are pushed to a Treiber stack (queue->inbox). A non-NULL
+ * `list_node.next` marks an event as queued, exactly as for the regular event
+ * queue, so producers first claim an event by swapping `next` from NULL to a
+ * non-NULL value. The stack is terminated by `_end` instead of NULL for
+ * the same reason.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "event/mpsc.h"
+#include "irq.h"
+#include "thread_flags.h"
+
+/* terminates the inbox stack, never dereferenced */
+static clist_node_t _end;
+
+#if defined(__GCC_ATOMIC_POINTER_LOCK_FREE) && (__GCC_ATOMIC_POINTER_LOCK_FREE == 2)
+static inline bool _cas(clist_node_t **ptr, clist_node_t *expected,
+                        clist_node_t *desired)
+{
+    return __atomic_compare_exchange_n(ptr, &expected, desired, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+static inline clist_node_t *_load(clist_node_t **ptr)
+{
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void _store(clist_node_t **ptr, clist_node_t *val)
+{
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+
+static inline clist_node_t *_xchg(clist_node_t **ptr, clist_node_t *val)
+{
+    return __atomic_exchange_n(ptr, val, __ATOMIC_ACQ_REL);
+}
+#else
+/* no lock-free pointer atomics (e.g. ARMv6-M): fall back to minimal critical
+ * sections */
+static inline bool _cas(clist_node_t **ptr, clist_node_t *expected,
+                        clist_node_t *desired)
+{
+    unsigned state = irq_disable();
+    bool res = (*ptr == expected);
+
+    if (res) {
+        *ptr = desired;
+    }
+    irq_restore(state);
+    return res;
+}
+
+static inline clist_node_t *_load(clist_node_t **ptr)
+{
+    return *(clist_node_t * volatile *)ptr;
+}
+
+static inline void _store(clist_node_t **ptr, clist_node_t *val)
+{
+    *(clist_node_t * volatile *)ptr = val;
+}
+
+static inline clist_node_t *_xchg(clist_node_t **ptr, clist_node_t *val)
+{
+    unsigned state = irq_disable();
+    clist_node_t *res = *ptr;
+
+    *ptr = val;
+    irq_restore(state);
+    return res;
+}
+#endif
+
+void event_mpsc_queue_init(event_mpsc_queue_t *queue)
+{
+    queue->event_list.next = NULL;
+    queue->inbox = &_end;
+    queue->waiter = thread_get_active();
+}
+
+void event_mpsc_post(event_mpsc_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+    assert(event->handler);
+
+    clist_node_t *node = &event->list_node;
+
+    /* claim the event, it is already queued if this fails */
+    if (!_cas(&node->next, NULL, &_end)) {
+        return;
+    }
+
+    clist_node_t *head;
+
+    do {
+        head = _load(&queue->inbox);
+        node->next = head;
+    } while (!_cas(&queue->inbox, head, node));
+
+    thread_flags_set(queue->waiter, THREAD_FLAG_EVENT);
+}
+
+/* moves all posted events to the consumer's list in the order of posting */
+static void _drain(event_mpsc_queue_t *queue)
+{
+    clist_node_t *node = _xchg(&queue->inbox, &_end);
+    clist_node_t *fifo = &_end;
+
+    /* the inbox holds the most recent event first, so reverse it.
+     * Note: `next` must never become NULL while an event is queued. */
+    while (node != &_end) {
+        clist_node_t *next = node->next;
+
+        node->next = fifo;
+        fifo = node;
+        node = next;
+    }
+
+    while (fifo != &_end) {
+        clist_node_t *next = fifo->next;
+
+        clist_rpush(&queue->event_list, fifo);
+        fifo = next;
+    }
+}
+
+void event_mpsc_cancel(event_mpsc_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+    assert(queue->waiter == thread_get_active());
+
+    _drain(queue);
+    if (clist_remove(&queue->event_list, &event->list_node)) {
+        _store(&event->list_node.next, NULL);
+    }
+}
+
+event_t *event_mpsc_get(event_mpsc_queue_t *queue)
+{
+    assert(queue->waiter == thread_get_active());
+
+    if (queue->event_list.next == NULL) {
+        _drain(queue);
+    }
+
+    clist_node_t *node = clist_lpop(&queue->event_list);
+
+    if (node == NULL) {
+        return NULL;
+    }
+
+    /* allow the event to be posted again */
+    _store(&node->next, NULL);
+    return container_of(node, event_t, list_node);
+}
+
+event_t *event_mpsc_wait(event_mpsc_queue_t *queue)
+{
+    event_t *event;
+
+    while ((event = event_mpsc_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+
+    return event;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_event_mpsc  Lock-free multi-producer event queue
+ * @ingroup     sys_event
+ * @brief       Event queue variant with a lock-free post path
+ *
+ * @ref event_post() disables interrupts while appending to the queue. When
+ * many interrupt sources post events in bursts, this adds to the interrupt
+ * latency. The queue provided by this module lets any number of producers
+ * (threads and ISRs) queue events without disabling interrupts: posted events
+ * are pushed to a lock-free "inbox" stack using compare-and-swap. The single
+ * consumer (the thread owning the queue) atomically takes the whole inbox
+ * and moves it in FIFO order to its private list.
+ *
+ * Waking the consumer still uses @ref thread_flags_set(), which disables
+ * interrupts for a short time, just as @ref event_post() does after appending.
+ *
+ * On platforms without lock-free pointer atomics (e.g. ARMv6-M), the atomic
+ * operations fall back to very short sections with interrupts disabled.
+ *
+ * Events are regular @ref event_t objects, so all event types (e.g.
+ * @ref event_callback_t) can be used with this queue. As with @ref
+ * event_post(), posting an event that is already queued has no effect.
+ *
+ * @warning All functions except @ref event_mpsc_post() must only be called
+ *          by the thread owning the queue.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free multi-producer event queue API
+ */
+
+#ifndef EVENT_MPSC_H
+#define EVENT_MPSC_H
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Multi-producer single-consumer event queue
+ *
+ * @note    All fields are private
+ */
+typedef struct {
+    clist_node_t event_list;    /**< events ready for the consumer          */
+    clist_node_t *inbox;        /**< lock-free stack of newly posted events */
+    thread_t *waiter;           /**< thread owning event queue              */
+} event_mpsc_queue_t;
+
+/**
+ * @brief   Initialize a multi-producer event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+void event_mpsc_queue_init(event_mpsc_queue_t *queue);
+
+/**
+ * @brief   Queue an event
+ *
+ * Can be called from any thread and from interrupt context. The event is
+ * queued without disabling interrupts, only waking the thread owning
+ * @p queue with @ref thread_flags_set() disables them.
+ *
+ * @pre     @p queue is initialized
+ *
+ * @param[in]   queue   event queue to queue event in
+ * @param[in]   event   event to queue in event queue
+ */
+void event_mpsc_post(event_mpsc_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Cancel a queued event
+ *
+ * @note    Runs in O(n)
+ *
+ * @param[in]   queue   event queue to remove event from
+ * @param[in]   event   event to remove from queue
+ */
+void event_mpsc_cancel(event_mpsc_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Get next event from event queue, non-blocking
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @returns     pointer to next event
+ * @returns     NULL if no event available
+ */
+event_t *event_mpsc_get(event_mpsc_queue_t *queue);
+
+/**
+ * @brief   Get next event from event queue, blocking
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @returns     pointer to next event
+ */
+event_t *event_mpsc_wait(event_mpsc_queue_t *queue);
+
+/**
+ * @brief   Simple event loop
+ *
+ * Waits for events to be queued and executes their handlers forever.
+ *
+ * @param[in]   queue   event queue to process
+ */
+static inline void event_mpsc_loop(event_mpsc_queue_t *queue)
+{
+    event_t *event;
+
+    while ((event = event_mpsc_wait(queue))) {
+        event->handler(event);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_MPSC_H */
+/** @} */
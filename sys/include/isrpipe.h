@@ -11,6 +11,12 @@
  * @ingroup sys
  * @brief ISR -> userspace pipe
  *
+ * The pipe is backed by a lock-free @ref sys_spsc_rb, so by default there
+ * must be only one writing context (e.g. an ISR) and one reading thread.
+ * Pipes initialized with @ref ISRPIPE_INIT_MULTI_PRODUCER() or
+ * @ref isrpipe_init_multi_producer() may be written from several contexts,
+ * writes to them are serialized by disabling interrupts.
+ *
  * @{
  * @file
  * @brief       isrpipe Interface
@@ -22,10 +28,11 @@
 #ifndef ISRPIPE_H
 #define ISRPIPE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "mutex.h"
-#include "tsrb.h"
+#include "spsc_rb.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,15 +42,23 @@ extern "C" {
  * @brief   Context structure for isrpipe
  */
 typedef struct {
-    tsrb_t tsrb;        /**< isrpipe thread safe ringbuffer */
+    spsc_rb_t rb;       /**< isrpipe lock-free ringbuffer */
     mutex_t mutex;      /**< isrpipe mutex */
+    bool multi_producer; /**< writes disable interrupts */
 } isrpipe_t;
 
 /**
  * @brief   Static initializer for irspipe
  */
-#define ISRPIPE_INIT(tsrb_buf) { .mutex = MUTEX_INIT, \
-                                 .tsrb = TSRB_INIT(tsrb_buf) }
+#define ISRPIPE_INIT(buf) { .mutex = MUTEX_INIT, \
+                            .rb = SPSC_RB_INIT(buf) }
+
+/**
+ * @brief   Static initializer for an irspipe written from several contexts
+ */
+#define ISRPIPE_INIT_MULTI_PRODUCER(buf) { .mutex = MUTEX_INIT, \
+                                           .rb = SPSC_RB_INIT(buf), \
+                                           .multi_producer = true }
 
 /**
  * @brief   Initialisation function for isrpipe
@@ -54,6 +69,16 @@ typedef struct {
  */
 void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize);
 
+/**
+ * @brief   Initialisation function for isrpipe written from several contexts
+ *
+ * @param[in]   isrpipe     isrpipe object to initialize
+ * @param[in]   buf         buffer to use as ringbuffer (must be power of two sized!)
+ * @param[in]   bufsize     size of @p buf
+ */
+void isrpipe_init_multi_producer(isrpipe_t *isrpipe, uint8_t *buf,
+                                 size_t bufsize);
+
 /**
  * @brief   Put one byte into the isrpipe's buffer
  *
@@ -150,6 +150,22 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Number of entries in the destination cache
+ *
+ * The destination cache keeps the next hop and the selected source address
+ * of the most recently used destinations of packets sent by this node. As
+ * long as the @ref gnrc_ipv6_nib_gen() "generation of the NIB" does not
+ * change, further packets to these destinations skip the next hop look-up in
+ * the @ref net_gnrc_ipv6_nib "NIB" and source address selection. Each entry
+ * takes about 70 bytes of RAM.
+ *
+ * Set to 0 to disable the destination cache.
+ */
+#ifndef CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+#define CONFIG_GNRC_IPV6_DST_CACHE_NUMOF       (0U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_fastfwd IPv6 forwarding fast path
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Forwards plain unicast packets within the receiving interface's
+ *              thread
+ *
+ * Normally, a packet to be forwarded is passed from the receiving interface
+ * to the IPv6 thread, which then passes it on to the sending interface. With
+ * this module, the receiving interface forwards packets directly when no
+ * processing by the IPv6 thread is required, saving one context switch and
+ * one message per packet and hop.
+ *
+ * A packet is only forwarded in the fast path, if
+ * - no one but the IPv6 thread is registered for IPv6 packets,
+ * - it is not for this node and its destination is neither multicast nor
+ *   link-local and its source is not link-local,
+ * - it has no Hop-by-Hop Options header,
+ * - its hop limit does not expire,
+ * - its link-layer address of the next hop is already known to the
+ *   @ref net_gnrc_ipv6_nib "NIB", and
+ * - it fits into the MTU of the sending interface.
+ *
+ * All other packets, including those that require an ICMPv6 error message,
+ * are handled by the IPv6 thread as before.
+ *
+ * @note    The fast path runs where a receiving interface passes a packet up
+ *          to the network layer. A 6LoWPAN interface passes its frames to the
+ *          @ref net_gnrc_sixlowpan "6LoWPAN thread" instead, which hands the
+ *          decompressed and reassembled packets to the IPv6 thread. Packets
+ *          received over 6LoWPAN, e.g. the upstream traffic of a border
+ *          router, therefore never take the fast path. Packets forwarded
+ *          *to* a 6LoWPAN interface do.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPv6 forwarding fast path definitions
+ */
+#ifndef NET_GNRC_IPV6_FASTFWD_H
+#define NET_GNRC_IPV6_FASTFWD_H
+
+#include <stdbool.h>
+
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Forwards a received packet if it qualifies for the fast path
+ *
+ * @pre `pkt != NULL`
+ *
+ * @param[in] pkt   A received packet in receive order, i.e. the IPv6 packet
+ *                  followed by its @ref net_gnrc_netif_hdr "netif header"
+ *
+ * @return  true, if the packet was consumed (forwarded or dropped).
+ * @return  false, if the packet needs to be handled by the IPv6 thread.
+ *          @p pkt is not modified in that case.
+ */
+bool gnrc_ipv6_fastfwd(gnrc_pktsnip_t *pkt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_FASTFWD_H */
+/** @} */
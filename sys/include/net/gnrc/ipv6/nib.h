@@ -358,6 +358,38 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the generation of the NIB
+ *
+ * The generation advances whenever information in the NIB or the addresses
+ * of an interface may have changed. Read-only accesses and calls to
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() that found a reachable neighbor
+ * do not advance it.
+ *
+ * This allows for caching the results of
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() and of source address selection:
+ * Read the generation before the look-up and only keep the results while the
+ * generation stays the same.
+ *
+ * @note    A cached result may skip neighbor unreachability detection and
+ *          @ref GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN. Results that need those
+ *          advance the generation during the look-up.
+ *
+ * @return  The current generation.
+ */
+uint32_t gnrc_ipv6_nib_gen(void);
+
+/**
+ * @brief   Advances the generation of the NIB
+ *
+ * To be called when information the results of
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() or source address selection
+ * depend on changed outside of the NIB, e.g. the addresses of an interface.
+ *
+ * @see gnrc_ipv6_nib_gen()
+ */
+void gnrc_ipv6_nib_changed(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
@@ -234,6 +234,19 @@ extern "C" {
 #ifndef CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD
 #define CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD             0
 #endif
+
+/**
+ * @brief   Index off-link entries in a prefix trie
+ *
+ * Without the trie, route lookups compare the destination with every
+ * off-link entry. With it, lookups take time proportional to the prefix
+ * lengths instead of @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, at the cost of
+ * about 50 bytes of RAM per off-link entry. Of several routes matching a
+ * destination, the one with the longest prefix is used.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                0
+#endif
 /** @} */
 
 /**
@@ -281,6 +294,22 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_NUMOF                   (4)
 #endif
 
+/**
+ * @brief   Number of slots in the hash index over the on-link entries
+ *
+ * Without the index, looking up a neighbor compares the address with every
+ * one of the @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries. With it, lookups take
+ * constant time on average, at the cost of one byte of RAM per slot (two
+ * bytes if @ref CONFIG_GNRC_IPV6_NIB_NUMOF is 255 or more).
+ *
+ * Set to 0 to disable the index. Otherwise, this must be a power of two
+ * larger than @ref CONFIG_GNRC_IPV6_NIB_NUMOF. About twice
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF is a good trade-off.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF          (0)
+#endif
+
 /**
  * @brief Per-neighbor packet queue capacity
  *
@@ -54,11 +54,47 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_train   Packet train extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Passes multiple packets with a single message
+ * @{
+ * @details The submodule `gnrc_netapi_train` allows to hand a train of
+ *          packets down to a network module with a single
+ *          @ref core_msg "message", so a burst of packets only wakes up each
+ *          layer once.
+ *
+ * A train is a @ref net_gnrc_pktbuf "packet buffer" snip of type
+ * @ref GNRC_NETTYPE_UNDEF whose data is an array of packet pointers (see
+ * @ref gnrc_netapi_train_build()). The train holds one reference to each of
+ * its packets. The receiver of a train takes over these references and
+ * releases the train itself once it got the packets out of it.
+ *
+ * Trains are only sent to threads that registered with
+ * @ref GNRC_NETREG_ENTRY_INIT_TRAIN() or @ref gnrc_netreg_entry_init_train().
+ * All other subscribers get the packets of a train one by one, so
+ * @ref gnrc_netapi_dispatch_train() can be used regardless of who is
+ * subscribed.
+ *
+ * Trains only exist on the send path: `gnrc_udp` and `gnrc_tcp` hand a train
+ * to `gnrc_ipv6`, which passes the packets that go out over the same
+ * interface on to `gnrc_netif` as a train again. Packets for 6LoWPAN
+ * interfaces are passed on one by one. Received packets are always
+ * dispatched one by one.
+ *
+ * To use, add the module `gnrc_netapi_train` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_train
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
 #define NET_GNRC_NETAPI_H
 
+#include "modules.h"
 #include "thread.h"
 #include "net/netopt.h"
 #include "net/gnrc/nettype.h"
@@ -93,6 +129,14 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a train of packets down the network
+ *          stack
+ *
+ * @note    Only used with @ref net_gnrc_netapi_train.
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_TRAIN  (0x0208)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -261,6 +305,91 @@ static inline int gnrc_netapi_set(kernel_pid_t pid, netopt_t opt,
                                 GNRC_NETAPI_MSG_TYPE_SET);
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+/**
+ * @brief   Bundles packets into a train
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in] pkts      the packets for the train. The train takes over the
+ *                      references to the packets if it was created
+ *                      successfully.
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return  the train on success
+ * @return  NULL, if no space is left in the packet buffer
+ */
+gnrc_pktsnip_t *gnrc_netapi_train_build(gnrc_pktsnip_t *const *pkts,
+                                        unsigned numof);
+
+/**
+ * @brief   Gets the number of packets in a train
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in] train     a train
+ *
+ * @return  number of packets in @p train
+ */
+static inline unsigned gnrc_netapi_train_len(const gnrc_pktsnip_t *train)
+{
+    return train->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet of a train
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in] train     a train
+ * @param[in] idx       index of the packet in @p train
+ *
+ * @return  the packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_train_get(const gnrc_pktsnip_t *train,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)train->data)[idx];
+}
+
+/**
+ * @brief   Sends the packets of @p train to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * Subscribers registered for trains get the whole train with one
+ * @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN message, all other subscribers get a
+ * @ref GNRC_NETAPI_MSG_TYPE_SND message for each packet of the train.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] train     the train of packets to send
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_train(gnrc_nettype_t type, uint32_t demux_ctx,
+                               gnrc_pktsnip_t *train);
+
+/**
+ * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN
+ *          messages
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in] pid       PID of the targeted network module. Must understand
+ *                      trains.
+ * @param[in] train     the train of packets to send
+ *
+ * @return              1 if the train was successfully delivered
+ * @return              -1 on error (invalid PID or no space in queue)
+ */
+static inline int gnrc_netapi_send_train(kernel_pid_t pid, gnrc_pktsnip_t *train)
+{
+    return _gnrc_netapi_send_recv(pid, train, GNRC_NETAPI_MSG_TYPE_SND_TRAIN);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -173,6 +173,19 @@ extern "C" {
 #ifndef CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
+
+/**
+ * @brief   Time in milliseconds to wait for the previous frame while sending
+ *          a packet train
+ *
+ * With the new netdev API, the next frame of a @ref net_gnrc_netapi_train
+ * "packet train" is only handed to the device once it reported the end of the
+ * previous transmission. If that takes longer than this, the rest of the
+ * train is dropped.
+ */
+#ifndef CONFIG_GNRC_NETIF_TRAIN_TX_TIMEOUT_MS
+#define CONFIG_GNRC_NETIF_TRAIN_TX_TIMEOUT_MS      (100U)
+#endif
 /** @} */
 
 /**
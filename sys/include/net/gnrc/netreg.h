@@ -35,8 +35,29 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf  GNRC netreg compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t "network type"
+ *
+ * The entries of a network type are distributed over the buckets by their
+ * @ref gnrc_netreg_entry_t::demux_ctx "demux context", so a lookup only walks
+ * the entries in one bucket. Raise this if many entries are registered for
+ * the same network type, e.g. a lot of UDP ports. Every bucket costs one
+ * pointer per network type.
+ *
+ * @note    Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS     (1U)
+#endif
+/** @} */
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
  *
@@ -47,10 +68,19 @@ typedef enum {
      * @brief   Use [default IPC](@ref core_msg) for
      *          [netapi](@ref net_gnrc_netapi) operations.
      *
-     * @note    Implicitly chosen without `gnrc_netapi_mbox` and
-     *          `gnrc_netapi_callbacks` modules.
+     * @note    Implicitly chosen without `gnrc_netapi_mbox`,
+     *          `gnrc_netapi_callbacks`, and `gnrc_netapi_train` modules.
      */
     GNRC_NETREG_TYPE_DEFAULT = 0,
+#if defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+    /**
+     * @brief   Like @ref GNRC_NETREG_TYPE_DEFAULT, but the thread also
+     *          understands @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN.
+     *
+     * @note    Only available with `gnrc_netapi_train` module.
+     */
+    GNRC_NETREG_TYPE_TRAIN,
+#endif
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
     /**
      * @brief   Use [centralized IPC](@ref core_mbox) for
@@ -93,7 +123,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_TRAIN)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -101,6 +132,28 @@ typedef enum {
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
 #endif
 
+/**
+ * @brief   Initializes a netreg entry statically with the PID of a thread that
+ *          understands @ref net_gnrc_netapi_train "packet trains"
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Equivalent to @ref GNRC_NETREG_ENTRY_INIT_PID() without
+ *          @ref net_gnrc_netapi_train.
+ *
+ * @return  An initialized netreg entry
+ */
+#if defined(MODULE_GNRC_NETAPI_TRAIN)
+#define GNRC_NETREG_ENTRY_INIT_TRAIN(demux_ctx, pid) { NULL, demux_ctx, \
+                                                       GNRC_NETREG_TYPE_TRAIN, \
+                                                       { pid } }
+#else
+#define GNRC_NETREG_ENTRY_INIT_TRAIN(demux_ctx, pid) \
+    GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry statically with mbox
@@ -181,12 +234,12 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
-     * @note    Only available with @ref net_gnrc_netapi_mbox or
-     *          @ref net_gnrc_netapi_callbacks.
+     * @note    Only available with @ref net_gnrc_netapi_mbox,
+     *          @ref net_gnrc_netapi_callbacks, or @ref net_gnrc_netapi_train.
      */
     gnrc_netreg_type_t type;
 #endif
@@ -275,12 +328,35 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_TRAIN)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
 }
 
+/**
+ * @brief   Initializes a netreg entry dynamically with the PID of a thread
+ *          that understands @ref net_gnrc_netapi_train "packet trains"
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Equivalent to @ref gnrc_netreg_entry_init_pid() without
+ *          @ref net_gnrc_netapi_train.
+ */
+static inline void gnrc_netreg_entry_init_train(gnrc_netreg_entry_t *entry,
+                                                uint32_t demux_ctx,
+                                                kernel_pid_t pid)
+{
+    gnrc_netreg_entry_init_pid(entry, demux_ctx, pid);
+#if defined(MODULE_GNRC_NETAPI_TRAIN)
+    entry->type = GNRC_NETREG_TYPE_TRAIN;
+#endif
+}
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry dynamically with mbox
@@ -342,6 +418,8 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  *
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
+ * @warning Do not change gnrc_netreg_entry_t::demux_ctx of @p entry while it
+ *          is registered.
  *
  * @pre The calling thread must provide a [message queue](@ref msg_init_queue)
  *      when using @ref GNRC_NETREG_TYPE_DEFAULT for gnrc_netreg_entry_t::type
@@ -31,6 +31,7 @@
 #define NET_GNRC_PKTBUF_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -63,6 +64,96 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @name    Size classes of `gnrc_pktbuf_bins`
+ *
+ * The `gnrc_pktbuf_bins` implementation serves allocations from pools of
+ * fixed size blocks instead of a single arena, so allocating and freeing
+ * take constant time and the buffer can not fragment into unusable holes.
+ * If the best fitting pool is exhausted, the next larger one is used.
+ *
+ * With the `gnrc_pktbuf_cache` module, every allocating thread keeps a small
+ * cache of free blocks per size class. @ref gnrc_pktbuf_add() is served from
+ * that cache without taking the packet buffer mutex; the cache is refilled
+ * in batches and freed blocks are put back into the cache of the releasing
+ * thread.
+ *
+ * The defaults follow the rationale of @ref CONFIG_GNRC_PKTBUF_SIZE: there
+ * are MTU sized blocks for two incoming and two outgoing packets. Headers
+ * and snip descriptors come from the smaller pools, so the arena (9 KiB)
+ * is larger than the default of @ref CONFIG_GNRC_PKTBUF_SIZE.
+ *
+ * @{
+ */
+/**
+ * @brief   Block size for packet snip descriptors and small headers
+ */
+#ifndef CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE      (48)
+#endif
+
+/**
+ * @brief   Number of small blocks
+ */
+#ifndef CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF     (32)
+#endif
+
+/**
+ * @brief   Block size for single link layer frames, e.g. IEEE 802.15.4 /
+ *          6LoWPAN frames
+ */
+#ifndef CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE
+#define CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE      (128)
+#endif
+
+/**
+ * @brief   Number of frame sized blocks
+ */
+#ifndef CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF
+#define CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF     (12)
+#endif
+
+/**
+ * @brief   Block size for full MTU packets, also the maximum size of a single
+ *          allocation
+ */
+#ifndef CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE
+#define CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE        (1536)
+#endif
+
+/**
+ * @brief   Number of MTU sized blocks
+ */
+#ifndef CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF
+#define CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF       (4)
+#endif
+
+/**
+ * @brief   Number of per-thread block caches of `gnrc_pktbuf_cache`
+ *
+ * A cache is bound to a thread when it first allocates from the packet
+ * buffer. Threads without a cache always take the mutex. The cache of a
+ * thread that has exited goes to the next thread claiming one, and all
+ * caches are drained before an allocation fails.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_CACHE_NUMOF
+#define CONFIG_GNRC_PKTBUF_CACHE_NUMOF          (4)
+#endif
+
+/**
+ * @brief   Maximum number of blocks per size class in a per-thread cache
+ *
+ * A cache never holds more than the number of blocks of a size class divided
+ * by @ref CONFIG_GNRC_PKTBUF_CACHE_NUMOF + 1, so this share of every class
+ * always stays available to all threads. With the defaults, only small and
+ * frame sized blocks are cached.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_CACHE_SIZE
+#define CONFIG_GNRC_PKTBUF_CACHE_SIZE           (8)
+#endif
+/** @} */
 /** @} */
 
 /**
@@ -296,13 +387,27 @@ gnrc_pktsnip_t *gnrc_pktbuf_reverse_snips(gnrc_pktsnip_t *pkt);
  */
 int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Gets the number of bytes still unused in the packet buffer
+ *
+ * @details The unused bytes may be spread over several chunks, so an
+ *          allocation of that size can still fail. Use this as an upper bound
+ *          of what the packet buffer can take, e.g. for a receive window.
+ *
+ * @return  number of unused bytes
+ * @return  SIZE_MAX, if the packet buffer has no fixed size
+ */
+size_t gnrc_pktbuf_free_bytes(void);
+
 #ifdef DEVELHELP
 /**
  * @brief   Prints some statistics about the packet buffer to stdout.
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_bins`, the usage, internal fragmentation and
+ *          allocation failures of every size class are printed.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -189,6 +189,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
  * @pre @p tcb must not be NULL
  *
  * @note Function blocks if user_timeout_duration_us is not zero.
+ * @note Connections are accepted in the order they were established.
  *
  * @param[in]  queue                      Listening queue to accept connection from.
  * @param[out] tcb                        Pointer to TCB associated with a established connection.
@@ -214,6 +215,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       With @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 1 the function returns
+ *       as soon as the data was sent and more segments may be in flight. The
+ *       acknowledgment of the data is not awaited in this case.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -268,6 +272,54 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                       const uint32_t user_timeout_duration_ms);
 
+#if defined(MODULE_GNRC_TCP_RECV_BUF) || defined(DOXYGEN)
+/**
+ * @brief Provides stack-internal buffer space containing received data.
+ *
+ * Works like @ref gnrc_tcp_recv() but lends the received data in the packet
+ * buffer to the caller instead of copying it. Each successful call provides
+ * the payload of (the rest of) one received segment. The data stays valid
+ * until this function is called again with the same @p buf_ctx, which
+ * releases it and returns 0:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * void *data, *ctx = NULL;
+ * ssize_t res;
+ *
+ * while ((res = gnrc_tcp_recv_buf(tcb, &data, &ctx, timeout)) > 0) {
+ *     consume(data, res);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The lent data counts against the receive window until it is released.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb, @p data and @p buf_ctx must not be NULL.
+ * @pre `*buf_ctx` is NULL or the context of the previous call on @p tcb.
+ *
+ * @note Only available with module `gnrc_tcp_recv_buf`.
+ * @note Lent data must be released before @p tcb is used for a new connection.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[out]    data                       Pointer to the received data.
+ * @param[in,out] buf_ctx                    Context of the lent data. Must be NULL on the
+ *                                           first call.
+ * @param[in]     user_timeout_duration_ms   Timeout for receive in milliseconds,
+ *                                           see @ref gnrc_tcp_recv().
+ *
+ * @return   The number of bytes at @p data.
+ * @return   0, if the data of the previous call was released or the connection
+ *           is closing and no further data can be read.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -EAGAIN if  user_timeout_duration_ms is zero and no data is available.
+ * @return   -ECONNRESET if connection was reset by the peer.
+ * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, void **buf_ctx,
+                          const uint32_t user_timeout_duration_ms);
+#endif
+
 /**
  * @brief Close a TCP connection.
  *
@@ -345,6 +397,11 @@ int gnrc_tcp_queue_get_local(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_ep_t *ep);
 /**
  * @brief Calculate and set checksum in TCP header.
  *
+ * @note A non-zero checksum field is taken as final and left untouched.
+ *       GNRC TCP fills in the checksum of the segments it sends on
+ *       synchronized connections itself. gnrc_tcp_hdr_build() initializes
+ *       the field with zero.
+ *
  * @param[in] hdr          Gnrc_pktsnip that contains TCP header.
  * @param[in] pseudo_hdr   Gnrc_pktsnip that contains network layer header.
  *
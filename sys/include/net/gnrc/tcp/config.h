@@ -101,6 +101,20 @@ extern "C" {
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
 #endif
 
+/**
+ * @brief Number of hash buckets for the lookup of connected TCBs.
+ *
+ * Incoming segments are matched against the TCBs in one bucket, selected by
+ * local port, peer port and peer address. TCBs waiting in LISTEN are kept in a
+ * separate list. Raise this if many connections are open at the same time.
+ * Every bucket costs one pointer.
+ *
+ * @note Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_TCP_TCB_HASH_BUCKETS
+#define CONFIG_GNRC_TCP_TCB_HASH_BUCKETS (1U)
+#endif
+
 /**
  * @brief Default receive buffer size
  */
@@ -108,6 +122,19 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of received segments a connection keeps queued.
+ *
+ * Only used with module `gnrc_tcp_recv_buf`. Received segments stay in the
+ * packet buffer until the application read them, instead of being copied into
+ * a receive buffer. The advertised window allows at most one MSS per free
+ * queue slot. Payload arriving while the queue is full, e.g. from many small
+ * segments, is merged with queued packets by copying.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RCV_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -168,6 +195,26 @@ extern "C" {
 #define CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS (60U * MS_PER_SEC)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments in flight per connection.
+ *        Default is 1 (stop-and-wait).
+ * @note Each segment stays in the packet buffer until it is acknowledged, so
+ *       the packet buffer must be sized accordingly. The peers receive window
+ *       and, with module `gnrc_tcp_congure_reno`, the congestion window limit
+ *       the amount of data in flight further.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit. Default is 3
+ * @see https://tools.ietf.org/html/rfc5681#section-3.2
+ */
+#ifndef CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD
+#define CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD (3U)
+#endif
+
 /**
  * @brief Message queue size for TCP API internal messaging
  * @note The number of elements in a message queue must be a power of two.
@@ -28,12 +28,17 @@
 #include "msg.h"
 #include "mbox.h"
 #include "net/gnrc/pkt.h"
+#include "net/tcp.h"
 #include "config.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_CONGURE_RENO
+#include "congure/reno.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -63,20 +68,45 @@ typedef struct sock_tcp {
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number that completes the rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
+    uint32_t recover;      /**< Send next when fast recovery was entered */
+    tcp_hdr_t hdr_tmpl;    /**< Header template of a synchronized connection */
+    uint16_t hdr_tmpl_sum; /**< Sum of the pseudo header and ports of hdr_tmpl */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Unacknowledged packets in the "retransmit queue", oldest first
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    uint8_t pkt_retransmit_num;           /**< Number of packets in pkt_retransmit */
+#if defined(MODULE_GNRC_TCP_CONGURE_RENO) || defined(DOXYGEN)
+    congure_reno_snd_t congure;           /**< Congestion control state */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
+#if defined(MODULE_GNRC_TCP_RECV_BUF) || defined(DOXYGEN)
+    /**
+     * @brief Received packets in sequence, oldest first
+     */
+    gnrc_pktsnip_t *rcv_pkts[CONFIG_GNRC_TCP_RCV_QUEUE_SIZE];
+    gnrc_pktsnip_t *rcv_pkt_borrowed; /**< Packet lent by gnrc_tcp_recv_buf() */
+    uint16_t rcv_pkt_offset;          /**< Bytes already read from rcv_pkts[0] */
+    uint16_t rcv_held;                /**< Bytes held in the packet buffer, headers included */
+    uint8_t rcv_pkts_num;             /**< Number of packets in rcv_pkts */
+#else
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
+    struct sock_tcp_queue *queue;    /**< Queue of a listening TCB */
+    struct sock_tcp *backlog_next;   /**< Next TCB in the accept backlog */
 } gnrc_tcp_tcb_t;
 
 /**
@@ -86,12 +116,18 @@ typedef struct sock_tcp_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+    /**
+     * @brief Established connections not yet accepted, oldest first
+     */
+    gnrc_tcp_tcb_t *backlog;
+    mbox_t *mbox;         /**< mbox of a blocked gnrc_tcp_accept() call */
+    mutex_t backlog_lock; /**< Mutex protecting backlog and mbox */
 } gnrc_tcp_tcb_queue_t;
 
 /**
  * @brief Static initializer for type gnrc_tcp_tcb_queue_t
  */
-#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0 }
+#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0, NULL, NULL, MUTEX_INIT }
 
 #ifdef __cplusplus
 }
@@ -73,6 +73,48 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Copies @p src to @p dst and calculates the unnormalized Internet
+ *          Checksum of it on the way, where the buffer provides a slice of the
+ *          full checksum domain, calculated in order.
+ *
+ * @details Same as inet_csum_slice() for @p src, but every byte is only read
+ *          once for both copying and summing. The buffers must not overlap.
+ *
+ * @param[in] sum       An initial value for the checksum.
+ * @param[out] dst      Buffer to copy @p src to. Must be at least @p len
+ *                      bytes long.
+ * @param[in] src       A buffer.
+ * @param[in] len       Length of @p src in byte.
+ * @param[in] accum_len Accumulated length of checksum domain that has already
+ *                      been checksummed.
+ *
+ * @return  The unnormalized Internet Checksum of @p src.
+ */
+uint16_t inet_csum_copy_slice(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                              uint16_t len, size_t accum_len);
+
+/**
+ * @brief   Copies @p src to @p dst and calculates the unnormalized Internet
+ *          Checksum of it on the way, where the buffer provides a standalone
+ *          domain for the checksum.
+ *
+ * @see     inet_csum_copy_slice()
+ *
+ * @param[in] sum       An initial value for the checksum.
+ * @param[out] dst      Buffer to copy @p src to. Must be at least @p len
+ *                      bytes long.
+ * @param[in] src       A buffer.
+ * @param[in] len       Length of @p src in byte.
+ *
+ * @return  The unnormalized Internet Checksum of @p src.
+ */
+static inline uint16_t inet_csum_copy(uint16_t sum, uint8_t *dst,
+                                      const uint8_t *src, uint16_t len)
+{
+    return inet_csum_copy_slice(sum, dst, src, len, 0);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -270,6 +270,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <sys/types.h>
@@ -373,6 +374,40 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram received with @ref sock_udp_recv_batch()
+ */
+typedef struct {
+    void *data;                 /**< Buffer for the payload */
+    size_t max_len;             /**< Space available at sock_udp_batch_rx_t::data */
+    size_t len;                 /**< Length of the payload copied to
+                                 *   sock_udp_batch_rx_t::data */
+    bool truncated;             /**< The payload did not fit and was cut
+                                 *   to sock_udp_batch_rx_t::max_len */
+    sock_udp_ep_t remote;       /**< Remote end point of the datagram */
+    /**
+     * @brief   Auxiliary data about the datagram
+     *
+     * sock_udp_aux_rx_t::flags selects the requested data as for
+     * @ref sock_udp_recv_aux()
+     */
+    sock_udp_aux_rx_t aux;
+} sock_udp_batch_rx_t;
+
+/**
+ * @brief   A datagram to send with @ref sock_udp_send_batch()
+ */
+typedef struct {
+    const void *data;               /**< Payload of the datagram */
+    size_t len;                     /**< Length of the payload */
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * May be `NULL`, if the sock has a remote end point
+     */
+    const sock_udp_ep_t *remote;
+} sock_udp_batch_tx_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -632,6 +667,52 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
     return sock_udp_recv_buf_aux(sock, data, buf_ctx, timeout, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages with a single call
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * Waits up to @p timeout for the first datagram like @ref sock_udp_recv_aux()
+ * and then takes all further datagrams that are already queued at @p sock,
+ * until @p num datagrams were received.
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Datagrams to receive. sock_udp_batch_rx_t::data,
+ *                      sock_udp_batch_rx_t::max_len and the flags of
+ *                      sock_udp_batch_rx_t::aux need to be set, all other
+ *                      members are set for every received datagram.
+ * @param[in] num       Number of elements in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * Unlike @ref sock_udp_recv_aux(), a datagram that does not fit into its
+ * buffer is not dropped but cut to sock_udp_batch_rx_t::max_len and marked
+ * with sock_udp_batch_rx_t::truncated. Datagrams from another remote than
+ * the one of @p sock are dropped and skipped.
+ *
+ * @note    Any other error ends the batch. If datagrams were received before
+ *          it, their number is returned.
+ *
+ * @return  The number of datagrams received on success.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p sock is not properly initialized (or closed while
+ *          sock_udp_recv_batch() blocks).
+ * @return  -ENOMEM, if no memory was available to receive the first datagram.
+ * @return  -EPROTO, if only datagrams from another remote than the one of
+ *          @p sock were queued.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_batch_rx_t *msgs,
+                        unsigned num, uint32_t timeout);
+
 /**
  * @brief   Sends a UDP message to remote end point with non-continous payload
  *
@@ -797,6 +878,30 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Sends multiple UDP messages with a single call
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * Implementations may hand all datagrams to the network stack at once.
+ * With `sock_async`, @ref SOCK_ASYNC_MSG_SENT is signaled once per call.
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] msgs      Datagrams to send, in order.
+ * @param[in] num       Number of elements in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of datagrams sent on success. If less than @p num, the
+ *          datagram after the last one sent failed.
+ * @return  An error of @ref sock_udp_sendv_aux(), if the first datagram could
+ *          not be sent.
+ */
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_batch_tx_t *msgs,
+                        unsigned num);
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_cycles Cycle counter based thread accounting
+ * @ingroup     sys
+ * @brief       Low overhead per-thread CPU time and context switch accounting
+ *
+ * In contrast to @ref schedstatistics, this module does not use the
+ * scheduler callback and does not read a ztimer on context switches. It
+ * implements @ref sched_switch_callback(), which the scheduler calls directly
+ * from @ref sched_run() when the active thread changes, and which reads a raw
+ * hardware counter:
+ *
+ * - the DWT cycle counter (CYCCNT) on Cortex-M cores that have one
+ *   (Cortex-M3, M4, M7, M33), counting at @ref CLOCK_CORECLOCK
+ * - otherwise the periph_timer backing @ref ZTIMER_USEC, read directly via
+ *   timer_read()
+ *
+ * This makes the module cheap enough to be enabled permanently. The counters
+ * can be read as a compact binary snapshot with @ref sched_cycles_snapshot()
+ * (e.g. to send them to a collector) and are shown by the `ps` shell
+ * command.
+ *
+ * When no idle thread is used, the time spent sleeping in the scheduler is
+ * accounted to @ref KERNEL_PID_UNDEF.
+ *
+ * @note    Time is accumulated at context switches and when the counters
+ *          are read. A thread running continuously for longer than the
+ *          counter takes to wrap around (e.g. ~65 ms for a 16 bit timer at
+ *          1 MHz, ~67 s for CYCCNT at 64 MHz) is undercounted unless the
+ *          counters are read more often than that.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Cycle counter based thread accounting API
+ */
+
+#ifndef SCHED_CYCLES_H
+#define SCHED_CYCLES_H
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Accounting data of a single thread
+ */
+typedef struct {
+    uint64_t cycles;        /**< counter ticks spent running */
+    uint32_t switches;      /**< number of times the thread was scheduled */
+} sched_cycles_t;
+
+/**
+ * @brief   Entry of a snapshot
+ *
+ * The layout has no padding on common platforms, so an array of entries can
+ * be sent as is to a collector of the same endianness.
+ */
+typedef struct {
+    uint64_t cycles;        /**< counter ticks spent running */
+    uint32_t switches;      /**< number of times the thread was scheduled */
+    kernel_pid_t pid;       /**< thread the entry belongs to */
+    uint16_t reserved;      /**< unused, zero */
+} sched_cycles_entry_t;
+
+/**
+ * @brief   Accounting data, indexed by PID
+ *
+ * @note    Call @ref sched_cycles_update() before reading the entry of the
+ *          running thread
+ */
+extern sched_cycles_t sched_cycles_pidlist[KERNEL_PID_LAST + 1];
+
+/**
+ * @brief   Initialize and start the counter
+ *
+ * @note    Called by auto_init
+ */
+void sched_cycles_init(void);
+
+/**
+ * @brief   Account the time elapsed since the last context switch to the
+ *          running thread
+ */
+void sched_cycles_update(void);
+
+/**
+ * @brief   Get the frequency the accounting counter runs at
+ *
+ * @returns     counter ticks per second
+ */
+uint32_t sched_cycles_freq(void);
+
+/**
+ * @brief   Take a consistent snapshot of all counters
+ *
+ * One entry is written for every existing thread, and one for
+ * @ref KERNEL_PID_UNDEF when no idle thread is used.
+ *
+ * @param[out]  entries     array to write the snapshot to
+ * @param[in]   numof       number of entries in @p entries
+ *
+ * @returns     number of entries written
+ */
+unsigned sched_cycles_snapshot(sched_cycles_entry_t *entries, unsigned numof);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_CYCLES_H */
+/** @} */
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_edf Earliest Deadline First Scheduling Class
+ * @ingroup     sys
+ * @brief       Periodic threads with budget enforcement, scheduled by
+ *              earliest deadline first within a band of priorities
+ *
+ * Threads admitted to this scheduling class declare a period and a budget
+ * (the CPU time they may use per period). Every period a new job of the
+ * thread is released, its absolute deadline being the end of that period.
+ *
+ * The module does not replace the fixed-priority scheduler. Instead, all
+ * admitted threads share the priority band starting at
+ * @ref CONFIG_SCHED_EDF_PRIO_HIGHEST. Whenever a job is released, finished or
+ * runs out of budget, the threads with pending jobs are sorted by deadline
+ * and assigned the priorities of the band in that order. Threads with higher
+ * priorities than the band (e.g. network interface threads) are never
+ * delayed by threads of this class, threads with lower priorities get the
+ * CPU time left over.
+ *
+ * Releases and budgets are driven by @ref ZTIMER_USEC timers that are only
+ * armed when needed, there is no periodic tick. The budget timer is started
+ * when a thread of this class is scheduled in and stopped when it is
+ * scheduled out. A thread that exhausts its budget is demoted to
+ * @ref CONFIG_SCHED_EDF_PRIO_BACKGROUND until its next release and its
+ * overrun counter is incremented, so a CPU-bound thread cannot starve
+ * threads of lower priority than the band.
+ *
+ * Admission control guarantees that the total utilization (sum of
+ * budget / period) of all admitted threads does not exceed
+ * @ref CONFIG_SCHED_EDF_UTIL_MAX. With implicit deadlines (deadline ==
+ * period) and no interference from higher priority threads, EDF meets all
+ * deadlines as long as the utilization does not exceed 100%.
+ *
+ * A typical thread of this class looks like this:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * static void *_dsp_thread(void *arg)
+ * {
+ *     if (sched_edf_admit(thread_getpid(), 10000, 2000) < 0) {
+ *         return NULL;
+ *     }
+ *     while (1) {
+ *         process_samples();
+ *         sched_edf_wait_period();
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    This module uses the scheduler callback. It chains
+ *          @ref sys_schedstatistics if that module is used as well.
+ *
+ * @warning Threads must be removed with @ref sched_edf_remove() before they
+ *          exit.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First scheduling class API
+ */
+
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdint.h>
+
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_sched_edf_conf EDF scheduling class configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Maximum number of threads in the EDF scheduling class
+ */
+#ifndef CONFIG_SCHED_EDF_NUMOF
+#define CONFIG_SCHED_EDF_NUMOF              (4U)
+#endif
+
+/**
+ * @brief   Highest priority of the band used by the EDF scheduling class
+ *
+ * The band spans @ref CONFIG_SCHED_EDF_NUMOF priorities. By default, it is
+ * located directly above @ref THREAD_PRIORITY_MAIN.
+ */
+#ifndef CONFIG_SCHED_EDF_PRIO_HIGHEST
+#define CONFIG_SCHED_EDF_PRIO_HIGHEST       (THREAD_PRIORITY_MAIN - \
+                                             CONFIG_SCHED_EDF_NUMOF)
+#endif
+
+/**
+ * @brief   Priority of threads that exhausted their budget
+ */
+#ifndef CONFIG_SCHED_EDF_PRIO_BACKGROUND
+#define CONFIG_SCHED_EDF_PRIO_BACKGROUND    (THREAD_PRIORITY_MIN - 1)
+#endif
+
+/**
+ * @brief   Maximum total utilization of all admitted threads in per mille
+ */
+#ifndef CONFIG_SCHED_EDF_UTIL_MAX
+#define CONFIG_SCHED_EDF_UTIL_MAX           (1000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Statistics of a thread in the EDF scheduling class
+ */
+typedef struct {
+    uint32_t period;            /**< period in microseconds                 */
+    uint32_t budget;            /**< budget per period in microseconds      */
+    uint32_t jobs;              /**< number of released jobs                */
+    uint32_t overruns;          /**< number of jobs that exhausted their
+                                     budget                                 */
+    uint32_t deadline_misses;   /**< number of jobs not finished before
+                                     their deadline                         */
+} sched_edf_stats_t;
+
+/**
+ * @brief   Initialize the EDF scheduling class
+ *
+ * @note    Called by auto_init
+ */
+void sched_edf_init(void);
+
+/**
+ * @brief   Admit a thread to the EDF scheduling class
+ *
+ * The first job of the thread is released immediately.
+ *
+ * @param[in]   pid         thread to admit
+ * @param[in]   period_us   period (and relative deadline) in microseconds
+ * @param[in]   budget_us   CPU time per period in microseconds
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     if @p pid is not a valid thread, @p budget_us is 0 or
+ *                      larger than @p period_us
+ * @retval  -EALREADY   if the thread has already been admitted
+ * @retval  -ENOMEM     if @ref CONFIG_SCHED_EDF_NUMOF threads are admitted
+ * @retval  -EBUSY      if admitting the thread would exceed
+ *                      @ref CONFIG_SCHED_EDF_UTIL_MAX
+ */
+int sched_edf_admit(kernel_pid_t pid, uint32_t period_us, uint32_t budget_us);
+
+/**
+ * @brief   Remove a thread from the EDF scheduling class
+ *
+ * The thread gets back the priority it had when it was admitted.
+ *
+ * @param[in]   pid         thread to remove
+ *
+ * @retval  0           on success
+ * @retval  -ENOENT     if @p pid is not in the EDF scheduling class
+ */
+int sched_edf_remove(kernel_pid_t pid);
+
+/**
+ * @brief   Finish the current job and sleep until the next release
+ *
+ * @pre     The calling thread has been admitted
+ */
+void sched_edf_wait_period(void);
+
+/**
+ * @brief   Get the number of jobs of a thread that exhausted their budget
+ *
+ * @param[in]   pid         thread to query
+ *
+ * @returns     number of overruns, 0 if @p pid is not in the EDF class
+ */
+unsigned sched_edf_overruns(kernel_pid_t pid);
+
+/**
+ * @brief   Get the statistics of a thread in the EDF scheduling class
+ *
+ * @param[in]   pid         thread to query
+ * @param[out]  stats       statistics of the thread
+ *
+ * @retval  0           on success
+ * @retval  -ENOENT     if @p pid is not in the EDF scheduling class
+ */
+int sched_edf_get_stats(kernel_pid_t pid, sched_edf_stats_t *stats);
+
+/**
+ * @brief   Get the total utilization of all admitted threads
+ *
+ * @returns     utilization in per mille
+ */
+unsigned sched_edf_utilization(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
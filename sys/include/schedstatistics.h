@@ -50,6 +50,14 @@ typedef struct {
  */
 extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+/**
+ *  @brief  Scheduler callback updating @ref sched_pidlist
+ *
+ *  Modules registering their own scheduler callback must call this function
+ *  from it to keep the statistics working.
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 /**
  *  @brief  Registers the sched statistics callback and sets laststart for
  *          caller thread
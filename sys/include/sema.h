@@ -46,13 +46,15 @@ extern "C" {
  *
  * @return  Statically initialized semaphore.
  */
-#define SEMA_CREATE(value)         { (value), SEMA_OK, MUTEX_INIT }
+#define SEMA_CREATE(value)         { .value = (value), .state = SEMA_OK, \
+                                     .mutex = MUTEX_INIT }
 
 /**
  * @brief   Creates semaphore statically initialized to 0
  * @return  Statically initialized semaphore.
  */
-#define SEMA_CREATE_LOCKED()        { (0), SEMA_OK, MUTEX_INIT_LOCKED }
+#define SEMA_CREATE_LOCKED()        { .value = 0, .state = SEMA_OK, \
+                                      .mutex = MUTEX_INIT_LOCKED }
 
 /**
  * @brief A Semaphore states.
@@ -69,6 +71,9 @@ typedef struct {
     unsigned int value;             /**< value of the semaphore */
     sema_state_t state;             /**< state of the semaphore */
     mutex_t mutex;                  /**< mutex of the semaphore */
+#if defined(MODULE_WAIT_ANY) || defined(DOXYGEN)
+    thread_t *waiter;               /**< thread waiting in @ref wait_any() */
+#endif
 } sema_t;
 
 /**
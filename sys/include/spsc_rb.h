@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_spsc_rb Lock-free single-producer single-consumer ringbuffer
+ * @ingroup     sys
+ * @brief       Lock-free byte and packet ringbuffer for one producer and one
+ *              consumer
+ *
+ * Unlike @ref sys_tsrb, this ringbuffer does not disable interrupts. It is
+ * safe as long as there is only one producer context (e.g. an ISR) and one
+ * consumer context (e.g. a thread). The producer only advances the write
+ * counter, the consumer only advances the read counter, so both sides can
+ * access the buffer concurrently. Data is copied with `memcpy()` in at most
+ * two contiguous parts.
+ *
+ * Besides copying, there are zero-copy interfaces for both sides:
+ * - the producer writes into the region returned by @ref spsc_rb_reserve()
+ *   and publishes it with @ref spsc_rb_commit()
+ * - the consumer reads from the region returned by @ref spsc_rb_peek_region()
+ *   and releases it with @ref spsc_rb_consume()
+ *
+ * In packet mode (@ref spsc_rb_add_pkt() and @ref spsc_rb_get_pkt()),
+ * variable length packets are framed with a two byte length header and are
+ * only added or removed as a whole. Byte and packet access must not be mixed
+ * on the same ringbuffer.
+ *
+ * @ref spsc_rb_clear() may be called from either side. If the producer
+ * clears the ringbuffer while the consumer copies data out, the consumer
+ * notices and retries. Regions obtained by @ref spsc_rb_peek_region() may be
+ * overwritten in that case.
+ *
+ * @attention   Buffer size must be a power of two!
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free SPSC ringbuffer interface definition
+ */
+
+#ifndef SPSC_RB_H
+#define SPSC_RB_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the packet header in packet mode
+ */
+#define SPSC_RB_PKT_HDR_SIZE    (sizeof(uint16_t))
+
+/**
+ * @brief   Lock-free SPSC ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< Buffer to operate on. */
+    unsigned int size;          /**< Size of buffer, must be power of 2. */
+    unsigned reads;             /**< total number of reads, owned by consumer */
+    unsigned writes;            /**< total number of writes, owned by producer */
+} spsc_rb_t;
+
+/**
+ * @brief   Static initializer
+ */
+#define SPSC_RB_INIT(BUF) { .buf = (BUF), .size = sizeof(BUF) }
+
+/**
+ * @brief       Initialize a ringbuffer
+ *
+ * @param[out]  rb          ringbuffer to initialize
+ * @param[in]   buffer      buffer to use
+ * @param[in]   bufsize     `sizeof (buffer)`, must be power of 2
+ */
+static inline void spsc_rb_init(spsc_rb_t *rb, uint8_t *buffer,
+                                unsigned bufsize)
+{
+    assert((bufsize != 0) && ((bufsize & (bufsize - 1)) == 0));
+
+    rb->buf = buffer;
+    rb->size = bufsize;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief       Get number of bytes available for reading
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ *
+ * @return      number of available bytes
+ */
+unsigned spsc_rb_avail(const spsc_rb_t *rb);
+
+/**
+ * @brief       Get free space in ringbuffer
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ *
+ * @return      number of free bytes
+ */
+unsigned spsc_rb_free(const spsc_rb_t *rb);
+
+/**
+ * @brief       Test if the ringbuffer is empty
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ *
+ * @return      true if empty
+ */
+static inline bool spsc_rb_empty(const spsc_rb_t *rb)
+{
+    return spsc_rb_avail(rb) == 0;
+}
+
+/**
+ * @brief       Drop all data in the ringbuffer
+ *
+ * May be called by the producer or the consumer.
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ */
+void spsc_rb_clear(spsc_rb_t *rb);
+
+/**
+ * @name    Producer side
+ * @{
+ */
+/**
+ * @brief       Add a byte to the ringbuffer
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[in]   c   byte to add
+ *
+ * @return      0 on success
+ * @return      -1 if the ringbuffer is full
+ */
+int spsc_rb_add_one(spsc_rb_t *rb, uint8_t c);
+
+/**
+ * @brief       Add bytes to the ringbuffer
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[in]   src buffer to copy from
+ * @param[in]   n   number of bytes to add
+ *
+ * @return      number of bytes added, less than @p n if the ringbuffer is full
+ */
+size_t spsc_rb_add(spsc_rb_t *rb, const void *src, size_t n);
+
+/**
+ * @brief       Get the contiguous free region for zero-copy writing
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[out]  len size of the region
+ *
+ * @return      start of the region
+ * @return      NULL if the ringbuffer is full
+ */
+uint8_t *spsc_rb_reserve(spsc_rb_t *rb, size_t *len);
+
+/**
+ * @brief       Publish bytes written into the region of @ref spsc_rb_reserve()
+ *
+ * @pre         @p n is not larger than the reserved region
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[in]   n   number of bytes written
+ */
+void spsc_rb_commit(spsc_rb_t *rb, size_t n);
+
+/**
+ * @brief       Add a packet to the ringbuffer
+ *
+ * The packet is either added as a whole or not at all.
+ *
+ * @param[in]   rb      ringbuffer to operate on
+ * @param[in]   data    packet data
+ * @param[in]   len     packet length
+ *
+ * @return      0 on success
+ * @return      -EAGAIN if there is currently not enough space
+ * @return      -EMSGSIZE if the packet never fits into the ringbuffer
+ */
+int spsc_rb_add_pkt(spsc_rb_t *rb, const void *data, size_t len);
+/** @} */
+
+/**
+ * @name    Consumer side
+ * @{
+ */
+/**
+ * @brief       Get a byte from the ringbuffer
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ *
+ * @return      >=0 byte that has been read
+ * @return      -1 if no byte available
+ */
+int spsc_rb_get_one(spsc_rb_t *rb);
+
+/**
+ * @brief       Get bytes from the ringbuffer
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[out]  dst buffer to copy to
+ * @param[in]   n   maximum number of bytes to get
+ *
+ * @return      number of bytes read
+ */
+size_t spsc_rb_get(spsc_rb_t *rb, void *dst, size_t n);
+
+/**
+ * @brief       Get bytes from the ringbuffer without removing them
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[out]  dst buffer to copy to
+ * @param[in]   n   maximum number of bytes to get
+ *
+ * @return      number of bytes copied
+ */
+size_t spsc_rb_peek(spsc_rb_t *rb, void *dst, size_t n);
+
+/**
+ * @brief       Drop bytes from the ringbuffer
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[in]   n   maximum number of bytes to drop
+ *
+ * @return      number of bytes dropped
+ */
+size_t spsc_rb_drop(spsc_rb_t *rb, size_t n);
+
+/**
+ * @brief       Get the contiguous readable region for zero-copy reading
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[out]  len size of the region
+ *
+ * @return      start of the region
+ * @return      NULL if the ringbuffer is empty
+ */
+const uint8_t *spsc_rb_peek_region(spsc_rb_t *rb, size_t *len);
+
+/**
+ * @brief       Release bytes read from the region of @ref spsc_rb_peek_region()
+ *
+ * Does nothing if the ringbuffer has been cleared in the meantime.
+ *
+ * @param[in]   rb  ringbuffer to operate on
+ * @param[in]   n   number of bytes to release
+ */
+void spsc_rb_consume(spsc_rb_t *rb, size_t n);
+
+/**
+ * @brief       Get a packet from the ringbuffer
+ *
+ * @param[in]   rb      ringbuffer to operate on
+ * @param[out]  dst     buffer to copy the packet to
+ * @param[in]   size    size of @p dst
+ *
+ * @return      length of the packet
+ * @return      -EAGAIN if there is no packet
+ * @return      -EMSGSIZE if the packet is larger than @p size, it is left
+ *              in the ringbuffer
+ */
+ssize_t spsc_rb_get_pkt(spsc_rb_t *rb, void *dst, size_t size);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSC_RB_H */
+/** @} */
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_stack_watermark Lazy stack watermark
+ * @ingroup     sys
+ * @brief       Track the stack high-water mark of all threads without
+ *              painting the stacks on thread creation
+ *
+ * Usually, stack usage is measured by filling ("painting") the whole stack
+ * with a known pattern in @ref thread_create() and searching for the first
+ * overwritten word from the bottom of the stack later on. With this module,
+ * @ref thread_create() only writes the stack guard. Instead, the stacks are
+ * painted lazily in small steps from a periodic event on
+ * @ref EVENT_PRIO_LOWEST:
+ *
+ * 1. The lowest stack pointer observed so far is the initial watermark.
+ * 2. The unpainted part of the stack below the watermark (minus
+ *    @ref CONFIG_STACK_WATERMARK_REDZONE) is painted, a chunk at a time with
+ *    interrupts disabled.
+ * 3. The painted part is scanned from the watermark down to the start of
+ *    the stack. Every overwritten word becomes the new watermark.
+ *
+ * Each step does at most @ref CONFIG_STACK_WATERMARK_STEP_WORDS words of
+ * work. Once all threads have been processed, the callback registered with
+ * @ref stack_watermark_set_cb() is called for every thread with its stack
+ * headroom, i.e. the number of bytes below the watermark.
+ *
+ * The painting pattern is the same as the one of @ref thread_create(), so
+ * @ref thread_measure_stack_free() gives correct results once a stack has
+ * been painted.
+ *
+ * @note    Stack usage before the stack was painted is only captured through
+ *          the stack pointers observed by this module.
+ *
+ * @note    Only Cortex-M and native are supported, as the stack pointer of a
+ *          suspended thread must be known.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lazy stack watermark API
+ */
+
+#ifndef STACK_WATERMARK_H
+#define STACK_WATERMARK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_stack_watermark_conf Lazy stack watermark configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Interval between two steps in milliseconds
+ */
+#ifndef CONFIG_STACK_WATERMARK_INTERVAL_MS
+#define CONFIG_STACK_WATERMARK_INTERVAL_MS      (100U)
+#endif
+
+/**
+ * @brief   Maximum number of words painted or scanned per step
+ */
+#ifndef CONFIG_STACK_WATERMARK_STEP_WORDS
+#define CONFIG_STACK_WATERMARK_STEP_WORDS       (256U)
+#endif
+
+/**
+ * @brief   Number of words painted or scanned with interrupts disabled
+ */
+#ifndef CONFIG_STACK_WATERMARK_CHUNK_WORDS
+#define CONFIG_STACK_WATERMARK_CHUNK_WORDS      (16U)
+#endif
+
+/**
+ * @brief   Bytes below the stack pointer of a thread that are never painted
+ *
+ * Covers data a suspended thread may still own below its stack pointer,
+ * e.g. the x86-64 red zone on native.
+ */
+#ifndef CONFIG_STACK_WATERMARK_REDZONE
+#ifdef CPU_NATIVE
+#define CONFIG_STACK_WATERMARK_REDZONE          (256U)
+#else
+#define CONFIG_STACK_WATERMARK_REDZONE          (32U)
+#endif
+#endif
+/** @} */
+
+/**
+ * @brief   Report callback
+ *
+ * @param[in]   pid         thread the report is about
+ * @param[in]   headroom    bytes of the stack that have not been used
+ * @param[in]   arg         argument passed to @ref stack_watermark_set_cb()
+ */
+typedef void (*stack_watermark_cb_t)(kernel_pid_t pid, size_t headroom,
+                                     void *arg);
+
+/**
+ * @brief   Start the periodic watermark update
+ *
+ * @note    Called by auto_init
+ */
+void stack_watermark_init(void);
+
+/**
+ * @brief   Register the report callback
+ *
+ * The callback is run in the context of the thread handling
+ * @ref EVENT_PRIO_LOWEST after all threads have been processed.
+ *
+ * @param[in]   cb      callback, NULL to disable reports
+ * @param[in]   arg     argument passed to @p cb
+ */
+void stack_watermark_set_cb(stack_watermark_cb_t cb, void *arg);
+
+/**
+ * @brief   Process up to @p words stack words
+ *
+ * This is called periodically by the module. It can be called directly
+ * to speed up the initial painting.
+ *
+ * @param[in]   words   maximum number of words to paint or scan
+ *
+ * @retval  true    all threads have been processed and reported
+ * @retval  false   otherwise
+ */
+bool stack_watermark_step(unsigned words);
+
+/**
+ * @brief   Get the stack headroom of a thread
+ *
+ * @param[in]   pid     thread to query
+ *
+ * @returns     bytes of the stack below the lowest known watermark
+ * @returns     0 if @p pid is not a valid thread
+ */
+size_t stack_watermark_headroom(kernel_pid_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACK_WATERMARK_H */
+/** @} */
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_thread_pool Thread pool
+ * @ingroup     sys
+ * @brief       Run short-lived jobs on worker threads with recycled stacks
+ *
+ * A thread pool owns a number of equally sized stack slabs, managed by a
+ * @ref sys_memarray, and a bounded queue of jobs. @ref thread_pool_submit()
+ * queues a job and hands it to an idle worker thread. If there is none, a
+ * new worker is created on a free stack slab. If all slabs are in use, the
+ * job stays queued until a worker becomes available.
+ *
+ * Workers do not exit after a job. Up to `keep_idle` workers stay parked
+ * waiting for the next job, so a job only costs a wakeup instead of a thread
+ * creation. Surplus workers exit when the queue runs empty and their stack
+ * slab is returned to the pool.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * static THREAD_POOL_STACKS(_stacks, THREAD_STACKSIZE_DEFAULT, 2);
+ * static thread_pool_job_t _jobs[4];
+ * static thread_pool_t _pool;
+ *
+ * thread_pool_init(&_pool, _stacks, sizeof(_stacks[0]), ARRAY_SIZE(_stacks),
+ *                  _jobs, ARRAY_SIZE(_jobs), THREAD_PRIORITY_MAIN - 1, 1,
+ *                  "worker");
+ * thread_pool_submit(&_pool, _handle_request, req);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    Workers are created with @ref THREAD_CREATE_NO_STACKTEST to keep
+ *          creation cheap, so their stack usage is not measured.
+ *
+ * @warning Jobs must return to give the worker back to the pool. A job must
+ *          not exit its thread in any other way.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread pool API
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdint.h>
+
+#include "cib.h"
+#include "list.h"
+#include "memarray.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Declare the stack slabs of a thread pool
+ *
+ * The slab size is rounded up to keep every slab aligned.
+ *
+ * @param   name        name of the array to declare
+ * @param   stacksize   stack size per worker, in bytes
+ * @param   num         number of slabs (maximum number of workers)
+ */
+#define THREAD_POOL_STACKS(name, stacksize, num) \
+    char name[num][((stacksize) + 7) & ~7] __attribute__((aligned(8)))
+
+/**
+ * @brief   Job function
+ *
+ * @param[in]   arg     argument passed to @ref thread_pool_submit()
+ */
+typedef void (*thread_pool_fn_t)(void *arg);
+
+/**
+ * @brief   Queued job
+ */
+typedef struct {
+    thread_pool_fn_t fn;        /**< function to run */
+    void *arg;                  /**< argument of @p fn */
+} thread_pool_job_t;
+
+/**
+ * @brief   Thread pool
+ *
+ * @note    All fields are private
+ */
+typedef struct {
+    list_node_t idle;           /**< parked workers                       */
+    memarray_t stacks;          /**< free stack slabs                     */
+    cib_t queue;                /**< index of queued jobs                 */
+    thread_pool_job_t *jobs;    /**< job queue storage                    */
+    const char *name;           /**< name of the worker threads           */
+    uint16_t stacksize;         /**< size of a stack slab                 */
+    uint8_t priority;           /**< priority of the worker threads       */
+    uint8_t keep_idle;          /**< number of idle workers to keep       */
+    uint8_t idle_numof;         /**< number of parked workers             */
+    uint8_t workers;            /**< number of running workers            */
+} thread_pool_t;
+
+/**
+ * @brief   Initialize a thread pool
+ *
+ * No worker threads are created until jobs are submitted.
+ *
+ * @pre     @p stacksize is a multiple of 8 and @p stacks is 8 byte aligned,
+ *          use @ref THREAD_POOL_STACKS to declare them
+ * @pre     @p queue_size is a power of two
+ *
+ * @param[out]  pool        thread pool to initialize
+ * @param[in]   stacks      memory for the stack slabs
+ * @param[in]   stacksize   size of a single stack slab
+ * @param[in]   num_stacks  number of stack slabs
+ * @param[in]   jobs        memory for the job queue
+ * @param[in]   queue_size  number of entries in @p jobs
+ * @param[in]   priority    priority of the worker threads
+ * @param[in]   keep_idle   number of idle workers kept alive, surplus
+ *                          workers exit and release their stack
+ * @param[in]   name        name of the worker threads
+ */
+void thread_pool_init(thread_pool_t *pool, void *stacks, size_t stacksize,
+                      size_t num_stacks, thread_pool_job_t *jobs,
+                      unsigned queue_size, uint8_t priority,
+                      unsigned keep_idle, const char *name);
+
+/**
+ * @brief   Queue a job to be run by a worker of @p pool
+ *
+ * @warning Must not be called from interrupt context
+ *
+ * @note    The job queue and the parked workers are protected by disabling
+ *          interrupts for a few instructions, there is no lock that could
+ *          block the caller. Only when a new worker is created, interrupts
+ *          stay disabled for the thread creation.
+ *
+ * @param[in]   pool    thread pool to run the job
+ * @param[in]   fn      function to run
+ * @param[in]   arg     argument passed to @p fn
+ *
+ * @retval  0           on success
+ * @retval  -EAGAIN     if the job queue is full
+ * @retval  -EOVERFLOW  if no worker exists and none could be created because
+ *                      there are too many threads. The job is not queued.
+ */
+int thread_pool_submit(thread_pool_t *pool, thread_pool_fn_t fn, void *arg);
+
+/**
+ * @brief   Get the number of queued jobs not yet picked up by a worker
+ *
+ * @param[in]   pool    thread pool to query
+ *
+ * @returns     number of queued jobs
+ */
+unsigned thread_pool_pending(thread_pool_t *pool);
+
+/**
+ * @brief   Get the number of worker threads of @p pool
+ *
+ * @param[in]   pool    thread pool to query
+ *
+ * @returns     number of running (busy or idle) workers
+ */
+unsigned thread_pool_workers(thread_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREAD_POOL_H */
+/** @} */
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_wait_any Wait on multiple sources
+ * @ingroup     sys
+ * @brief       Block until one of several IPC objects becomes ready
+ *
+ * @ref wait_any() blocks the calling thread until at least one of the given
+ * sources is ready and returns the index of the first ready one. Supported
+ * sources are:
+ *
+ * | Source                    | Ready when                         | Fetch with            |
+ * |:------------------------- |:---------------------------------- |:--------------------- |
+ * | @ref WAIT_ANY_FLAGS       | one of the thread flags is set     | thread_flags_clear()  |
+ * | @ref WAIT_ANY_MSG         | a message can be received          | msg_try_receive()     |
+ * | @ref WAIT_ANY_MBOX        | the mailbox has a queued message   | mbox_try_get()        |
+ * | @ref WAIT_ANY_SEMA        | the semaphore value is not zero    | sema_try_wait()       |
+ * | @ref WAIT_ANY_EVENT       | the event queue is not empty       | event_get()           |
+ *
+ * Nothing is consumed by @ref wait_any(), the caller fetches from the ready
+ * source with the non-blocking function listed above.
+ *
+ * All sources signal readiness via thread flags, so the waiting thread is
+ * blocked once in @ref STATUS_FLAG_BLOCKED_ANY and woken up by the first
+ * source that becomes ready. Mailboxes (via @ref mbox_set_notify()) and
+ * semaphores notify the waiter with @ref THREAD_FLAG_WAIT_ANY, the message
+ * queue with @ref THREAD_FLAG_MSG_WAITING and event queues with
+ * @ref THREAD_FLAG_EVENT.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * const wait_any_src_t srcs[] = {
+ *     WAIT_ANY_SRC_EVENT(&queue),
+ *     WAIT_ANY_SRC_MBOX(&mbox),
+ *     WAIT_ANY_SRC_MSG(),
+ * };
+ *
+ * while (1) {
+ *     switch (wait_any(srcs, ARRAY_SIZE(srcs))) {
+ *     case 0:
+ *         ...
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    Only one thread at a time may wait on a given mailbox or
+ *          semaphore with @ref wait_any(). Other threads taking from the
+ *          same object may win the race, so the non-blocking fetch can fail.
+ *          Just call @ref wait_any() again in that case.
+ *
+ * @note    Event queues must be claimed by the calling thread.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Wait on multiple sources API
+ */
+
+#ifndef WAIT_ANY_H
+#define WAIT_ANY_H
+
+#include <stddef.h>
+
+#include "event.h"
+#include "mbox.h"
+#include "msg.h"
+#include "sema.h"
+#include "thread_flags.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Thread flag used by mailboxes and semaphores to notify the thread
+ *          waiting in @ref wait_any()
+ */
+#ifndef THREAD_FLAG_WAIT_ANY
+#define THREAD_FLAG_WAIT_ANY    (1u << 13)
+#endif
+
+/**
+ * @brief   Source types
+ */
+typedef enum {
+    WAIT_ANY_FLAGS,         /**< thread flags of the calling thread */
+    WAIT_ANY_MSG,           /**< message queue of the calling thread */
+    WAIT_ANY_MBOX,          /**< mailbox */
+    WAIT_ANY_SEMA,          /**< semaphore */
+    WAIT_ANY_EVENT,         /**< event queue */
+} wait_any_type_t;
+
+/**
+ * @brief   Source to wait on
+ */
+typedef struct {
+    wait_any_type_t type;       /**< source type */
+    union {
+        thread_flags_t flags;   /**< flags to wait for (@ref WAIT_ANY_FLAGS) */
+        mbox_t *mbox;           /**< mailbox (@ref WAIT_ANY_MBOX) */
+        sema_t *sema;           /**< semaphore (@ref WAIT_ANY_SEMA) */
+        event_queue_t *queue;   /**< event queue (@ref WAIT_ANY_EVENT) */
+    };
+} wait_any_src_t;
+
+/**
+ * @brief   Initializer for a thread flags source
+ *
+ * @param   mask    thread flags to wait for
+ */
+#define WAIT_ANY_SRC_FLAGS(mask)    { .type = WAIT_ANY_FLAGS, .flags = (mask) }
+
+/**
+ * @brief   Initializer for the message queue of the calling thread
+ */
+#define WAIT_ANY_SRC_MSG()          { .type = WAIT_ANY_MSG }
+
+/**
+ * @brief   Initializer for a mailbox source
+ *
+ * @param   m       mailbox to wait on
+ */
+#define WAIT_ANY_SRC_MBOX(m)        { .type = WAIT_ANY_MBOX, .mbox = (m) }
+
+/**
+ * @brief   Initializer for a semaphore source
+ *
+ * @param   s       semaphore to wait on
+ */
+#define WAIT_ANY_SRC_SEMA(s)        { .type = WAIT_ANY_SEMA, .sema = (s) }
+
+/**
+ * @brief   Initializer for an event queue source
+ *
+ * @param   q       event queue to wait on
+ */
+#define WAIT_ANY_SRC_EVENT(q)       { .type = WAIT_ANY_EVENT, .queue = (q) }
+
+/**
+ * @brief   Wait until one of @p srcs is ready
+ *
+ * If several sources are ready, the one with the lowest index is returned,
+ * so sources should be ordered by priority.
+ *
+ * @pre     @p numof > 0
+ * @pre     Event queues in @p srcs are claimed by the calling thread
+ *
+ * @param[in]   srcs    sources to wait on
+ * @param[in]   numof   number of entries in @p srcs
+ *
+ * @returns     index of the ready source in @p srcs
+ */
+size_t wait_any(const wait_any_src_t *srcs, size_t numof);
+
+/**
+ * @brief   Notify a thread waiting in @ref wait_any()
+ *
+ * @internal    Used by semaphores
+ *
+ * @param[in]   waiter  thread to notify, may be NULL
+ */
+static inline void wait_any_notify(thread_t *waiter)
+{
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_WAIT_ANY);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAIT_ANY_H */
+/** @} */
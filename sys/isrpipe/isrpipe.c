@@ -17,17 +17,35 @@
  * @}
  */
 
+#include "irq.h"
 #include "isrpipe.h"
 
 void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize)
 {
     mutex_init(&isrpipe->mutex);
-    tsrb_init(&isrpipe->tsrb, buf, bufsize);
+    spsc_rb_init(&isrpipe->rb, buf, bufsize);
+    isrpipe->multi_producer = false;
+}
+
+void isrpipe_init_multi_producer(isrpipe_t *isrpipe, uint8_t *buf,
+                                 size_t bufsize)
+{
+    isrpipe_init(isrpipe, buf, bufsize);
+    isrpipe->multi_producer = true;
 }
 
 int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c)
 {
-    int res = tsrb_add_one(&isrpipe->tsrb, c);
+    int res;
+
+    if (isrpipe->multi_producer) {
+        unsigned state = irq_disable();
+        res = spsc_rb_add_one(&isrpipe->rb, c);
+        irq_restore(state);
+    }
+    else {
+        res = spsc_rb_add_one(&isrpipe->rb, c);
+    }
 
     /* `res` is either 0 on success or -1 when the buffer is full. Either way,
      * unlocking the mutex is fine.
@@ -39,7 +57,16 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c)
 
 int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n)
 {
-    int res = tsrb_add(&isrpipe->tsrb, buf, n);
+    int res;
+
+    if (isrpipe->multi_producer) {
+        unsigned state = irq_disable();
+        res = spsc_rb_add(&isrpipe->rb, buf, n);
+        irq_restore(state);
+    }
+    else {
+        res = spsc_rb_add(&isrpipe->rb, buf, n);
+    }
 
     mutex_unlock(&isrpipe->mutex);
 
@@ -50,7 +77,7 @@ int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
 {
     int res;
 
-    while (!(res = tsrb_get(&isrpipe->tsrb, buffer, count))) {
+    while (!(res = spsc_rb_get(&isrpipe->rb, buffer, count))) {
         mutex_lock(&isrpipe->mutex);
     }
     return res;
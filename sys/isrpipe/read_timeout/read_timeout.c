@@ -37,7 +37,7 @@ static void _cb(void *arg)
 
 int isrpipe_read_timeout(isrpipe_t *isrpipe, uint8_t *buffer, size_t count, uint32_t timeout)
 {
-    int res = tsrb_get(&isrpipe->tsrb, buffer, count);
+    int res = spsc_rb_get(&isrpipe->rb, buffer, count);
     if (res > 0) {
         return res;
     }
@@ -46,7 +46,7 @@ int isrpipe_read_timeout(isrpipe_t *isrpipe, uint8_t *buffer, size_t count, uint
     ztimer_t timer = { .callback = _cb, .arg = &_timeout };
 
     ztimer_set(ZTIMER_USEC, &timer, timeout);
-    while ((res = tsrb_get(&isrpipe->tsrb, buffer, count)) == 0) {
+    while ((res = spsc_rb_get(&isrpipe->rb, buffer, count)) == 0) {
         mutex_lock(&isrpipe->mutex);
         if (_timeout.flag) {
             /* timer was consumed */
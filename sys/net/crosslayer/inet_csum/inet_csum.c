@@ -13,16 +13,173 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "architecture.h"
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+#if ARCHITECTURE_WORD_BITS >= 32
+static uint16_t _fold(uint64_t acc)
+{
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    return (acc & 0xffff) + (acc >> 16);
+}
+
+/**
+ * @brief   Sums up @p src as 16-bit words in host byte order and copies it to
+ *          @p dst on the way, if @p dst is not NULL
+ *
+ * The first byte of @p src starts a word. Words are loaded at aligned
+ * addresses only, if @p src is not aligned to a word the bytes are paired
+ * the other way round and the result is swapped in the end (RFC 1071,
+ * section 2 (B)).
+ *
+ * @return  the folded sum in host byte order
+ */
+static inline __attribute__((always_inline))
+uint16_t _sum_host(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint64_t acc = 0;
+    bool odd = (uintptr_t)src & 1;
+
+    if (len == 0) {
+        return 0;
+    }
+    if (odd) {
+        /* first byte is the second half of a word at the aligned address */
+        acc = (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) ? (*src << 8) : *src;
+        if (dst) {
+            *(dst++) = *src;
+        }
+        src++;
+        len--;
+    }
+    if ((len >= 2) && ((uintptr_t)src & 2)) {
+        uint16_t w;
+
+        memcpy(&w, src, sizeof(w));
+        if (dst) {
+            memcpy(dst, &w, sizeof(w));
+            dst += sizeof(w);
+        }
+        acc += w;
+        src += sizeof(w);
+        len -= sizeof(w);
+    }
+#if defined(__SSE2__)
+    if (len >= 16) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i vacc = zero;
+        uint64_t lanes[2];
+
+        /* add up 32-bit words in 64-bit lanes, no carry can get lost */
+        for (; len >= 16; src += 16, len -= 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)src);
+
+            if (dst) {
+                _mm_storeu_si128((__m128i *)dst, v);
+                dst += 16;
+            }
+            vacc = _mm_add_epi64(vacc, _mm_unpacklo_epi32(v, zero));
+            vacc = _mm_add_epi64(vacc, _mm_unpackhi_epi32(v, zero));
+        }
+        _mm_storeu_si128((__m128i *)lanes, vacc);
+        acc += _fold(lanes[0]);
+        acc += _fold(lanes[1]);
+    }
+#else
+    /* add up 32-bit words in a 64-bit accumulator, no carry can get lost */
+    for (; len >= 16; src += 16, len -= 16) {
+        uint32_t w[4];
+
+        memcpy(w, __builtin_assume_aligned(src, 4), sizeof(w));
+        if (dst) {
+            memcpy(dst, w, sizeof(w));
+            dst += sizeof(w);
+        }
+        acc += (uint64_t)w[0] + w[1] + w[2] + w[3];
+    }
+#endif
+    for (; len >= 4; src += 4, len -= 4) {
+        uint32_t w;
+
+        memcpy(&w, __builtin_assume_aligned(src, 4), sizeof(w));
+        if (dst) {
+            memcpy(dst, &w, sizeof(w));
+            dst += sizeof(w);
+        }
+        acc += w;
+    }
+    if (len >= 2) {
+        uint16_t w;
+
+        memcpy(&w, src, sizeof(w));
+        if (dst) {
+            memcpy(dst, &w, sizeof(w));
+            dst += sizeof(w);
+        }
+        acc += w;
+        src += sizeof(w);
+        len -= sizeof(w);
+    }
+    if (len) {
+        /* last byte is the first half of a word */
+        acc += (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) ? *src : (*src << 8);
+        if (dst) {
+            *dst = *src;
+        }
+    }
+
+    uint16_t res = _fold(acc);
+
+    return (odd) ? byteorder_swaps(res) : res;
+}
+
+/**
+ * @brief   Sums up the big-endian 16-bit words of @p src and copies it to
+ *          @p dst on the way, if @p dst is not NULL
+ *
+ * @pre     @p len is even
+ */
+static inline __attribute__((always_inline))
+uint16_t _sum_words(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    return ntohs(_sum_host(dst, src, len));
+}
+#else /* ARCHITECTURE_WORD_BITS >= 32 */
+static inline __attribute__((always_inline))
+uint32_t _sum_words(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint32_t csum = 0;
+
+    if (dst) {
+        memcpy(dst, src, len);
+    }
+    for (unsigned i = 0; i < (len >> 1); src += 2, i++) {
+        csum += (uint16_t)(*src << 8) + *(src + 1);  /* group bytes by 16-byte words */
+                                                    /* and add them */
+    }
+    return csum;
+}
+#endif /* ARCHITECTURE_WORD_BITS >= 32 */
+
+static inline __attribute__((always_inline))
+uint16_t _csum_slice(uint16_t sum, uint8_t *dst, const uint8_t *buf,
+                     uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
 
@@ -42,18 +199,23 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
 
     if (accum_len & 1) {      /* if accumulated length is odd */
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
+        if (dst) {
+            *(dst++) = *buf;
+        }
         buf++;
         len--;
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    csum += _sum_words(dst, buf, len & ~1);
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
+    if ((accum_len + len) & 1) {        /* if accumulated length is odd */
+        buf += len - 1;
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+        if (dst) {
+            dst[len - 1] = *buf;
+        }
+    }
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
@@ -65,4 +227,15 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
     return csum;
 }
 
+uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+{
+    return _csum_slice(sum, NULL, buf, len, accum_len);
+}
+
+uint16_t inet_csum_copy_slice(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                              uint16_t len, size_t accum_len)
+{
+    return _csum_slice(sum, dst, src, len, accum_len);
+}
+
 /** @} */
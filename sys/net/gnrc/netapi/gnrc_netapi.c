@@ -82,6 +82,51 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+static void _dispatch_single(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                             gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_TRAIN)
+    uint32_t status = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+        case GNRC_NETREG_TYPE_TRAIN:
+#endif
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            status = ECANCELED;
+            break;
+    }
+    if (status != 0) {
+        gnrc_pktbuf_release_error(pkt, status);
+    }
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release_error(pkt, EIO);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -96,43 +141,61 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
-#endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
-            }
-            if (status != 0) {
-                gnrc_pktbuf_release_error(pkt, status);
+            _dispatch_single(sendto, cmd, pkt);
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    gnrc_netreg_release_shared();
+
+    return numof;
+}
+
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+gnrc_pktsnip_t *gnrc_netapi_train_build(gnrc_pktsnip_t *const *pkts,
+                                        unsigned numof)
+{
+    assert(numof > 0);
+    return gnrc_pktbuf_add(NULL, pkts, numof * sizeof(*pkts),
+                           GNRC_NETTYPE_UNDEF);
+}
+
+int gnrc_netapi_dispatch_train(gnrc_nettype_t type, uint32_t demux_ctx,
+                               gnrc_pktsnip_t *train)
+{
+    unsigned len = gnrc_netapi_train_len(train);
+
+    gnrc_netreg_acquire_shared();
+
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof != 0) {
+        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+
+        /* every subscriber gets its own reference to the train and to each
+         * of its packets */
+        gnrc_pktbuf_hold(train, numof - 1);
+        for (unsigned i = 0; i < len; i++) {
+            gnrc_pktbuf_hold(gnrc_netapi_train_get(train, i), numof - 1);
+        }
+
+        while (sendto) {
+            if (sendto->type != GNRC_NETREG_TYPE_TRAIN) {
+                /* subscriber only understands single packets */
+                for (unsigned i = 0; i < len; i++) {
+                    _dispatch_single(sendto, GNRC_NETAPI_MSG_TYPE_SND,
+                                     gnrc_netapi_train_get(train, i));
+                }
+                gnrc_pktbuf_release(train);
             }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
+            else if (gnrc_netapi_send_train(sendto->target.pid, train) < 1) {
+                /* unable to dispatch train */
+                for (unsigned i = 0; i < len; i++) {
+                    gnrc_pktbuf_release_error(gnrc_netapi_train_get(train, i),
+                                              EIO);
+                }
+                gnrc_pktbuf_release(train);
             }
-#endif
             sendto = gnrc_netreg_getnext(sendto);
         }
     }
@@ -141,3 +204,4 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 
     return numof;
 }
+#endif
@@ -178,8 +178,18 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
 
     if (bytes_expected > 0) {
+        /* with scatter support the Ethernet header is read to the stack, so
+         * it does not need to be split off the packet buffer afterwards */
+        int hdr_len = (dev->driver->recv_iol &&
+                       (bytes_expected > (int)sizeof(ethernet_hdr_t)))
+                    ? (int)sizeof(ethernet_hdr_t) : 0;
+        gnrc_pktsnip_t *eth_hdr = NULL;
+        ethernet_hdr_t l2_hdr;
+        ethernet_hdr_t *hdr;
+        int nread;
+
         pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
+                              bytes_expected - hdr_len,
                               GNRC_NETTYPE_UNDEF);
 
         if (!pkt) {
@@ -191,8 +201,22 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             goto out;
         }
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
+        if (hdr_len) {
+            iolist_t payload = { .iol_base = pkt->data, .iol_len = pkt->size };
+            iolist_t iolist = {
+                .iol_next = &payload,
+                .iol_base = &l2_hdr,
+                .iol_len = sizeof(l2_hdr),
+            };
+
+            nread = dev->driver->recv_iol(dev, &iolist, &rx_info);
+            hdr = &l2_hdr;
+        }
+        else {
+            nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
+            hdr = pkt->data;
+        }
+        if (nread <= hdr_len) {
             DEBUG("gnrc_netif_ethernet: read error.\n");
             goto safe_out;
         }
@@ -206,24 +230,26 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
              * so free the unused space.*/
 
             DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
+            gnrc_pktbuf_realloc_data(pkt, nread - hdr_len);
         }
 
         DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
-              gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
+              gnrc_netif_addr_to_str(hdr->dst, ETHERNET_ADDR_LEN, addr_str),
               nread);
 #if defined(MODULE_OD) && ENABLE_DEBUG
-        od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
+        od_hex_dump(pkt->data, pkt->size, OD_WIDTH_DEFAULT);
 #endif
-        /* mark ethernet header */
-        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
-        if (!eth_hdr) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            goto safe_out;
+        if (!hdr_len) {
+            /* mark ethernet header */
+            eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
+            if (!eth_hdr) {
+                DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+                goto safe_out;
+            }
+
+            hdr = (ethernet_hdr_t *)eth_hdr->data;
         }
 
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)eth_hdr->data;
-
 #ifdef MODULE_L2FILTER
         if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
             DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
@@ -242,7 +268,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         if (netif_hdr == NULL) {
             DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            pkt = eth_hdr;
+            if (eth_hdr) {
+                pkt = eth_hdr;
+            }
             goto safe_out;
         }
 
@@ -254,7 +282,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             gnrc_netif_hdr_set_timestamp(netif_hdr->data, rx_info.timestamp);
         }
 
-        gnrc_pktbuf_remove_snip(pkt, eth_hdr);
+        if (eth_hdr) {
+            gnrc_pktbuf_remove_snip(pkt, eth_hdr);
+        }
         pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
@@ -27,6 +27,9 @@
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
+#if IS_USED(MODULE_GNRC_IPV6_FASTFWD)
+#include "net/gnrc/ipv6/fastfwd.h"
+#endif /* IS_USED(MODULE_GNRC_IPV6_FASTFWD) */
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
@@ -650,6 +653,8 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
 #ifdef MODULE_GNRC_IPV6_NIB
+    /* source address selection may choose differently now */
+    gnrc_ipv6_nib_changed();
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
         gnrc_ipv6_nib_pl_t ple;
@@ -712,6 +717,9 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
     if (remove_sol_nodes) {
         gnrc_netif_ipv6_group_leave_internal(netif, &sol_nodes);
     }
+#ifdef MODULE_GNRC_IPV6_NIB
+    gnrc_ipv6_nib_changed();
+#endif
     gnrc_netif_release(netif);
 }
 
@@ -1727,6 +1735,25 @@ static event_t *_gnrc_netif_fetch_event(gnrc_netif_t *netif)
     return NULL;
 }
 
+/**
+ * @brief   Process all pending events without blocking
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ */
+static void _process_events(gnrc_netif_t *netif)
+{
+    DEBUG("gnrc_netif: handling events\n");
+    event_t *evp;
+    /* We can not use event_loop() or event_wait() because then we would not
+     * wake up when a message arrives */
+    while ((evp = _gnrc_netif_fetch_event(netif))) {
+        DEBUG("gnrc_netif: event %p\n", (void *)evp);
+        if (evp->handler) {
+            evp->handler(evp);
+        }
+    }
+}
+
 /**
  * @brief   Process any pending events and wait for IPC messages
  *
@@ -1745,16 +1772,7 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
 
         /* First drain the queues before blocking the thread */
         /* Events will be handled before messages */
-        DEBUG("gnrc_netif: handling events\n");
-        event_t *evp;
-        /* We can not use event_loop() or event_wait() because then we would not
-         * wake up when a message arrives */
-        while ((evp = _gnrc_netif_fetch_event(netif))) {
-            DEBUG("gnrc_netif: event %p\n", (void *)evp);
-            if (evp->handler) {
-                evp->handler(evp);
-            }
-        }
+        _process_events(netif);
         /* non-blocking msg check */
         int msg_waiting = msg_try_receive(msg);
         if (msg_waiting > 0) {
@@ -1766,6 +1784,42 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN) && IS_USED(MODULE_NETDEV_NEW_API)
+/**
+ * @brief   Block until the device finished the frame currently in transmission
+ *
+ * A train hands several frames to the interface with a single message. With
+ * the new netdev API the device only accepts the next frame after the TX done
+ * event of the previous one was handled, so process events in between.
+ *
+ * @param[in]   netif   gnrc_netif instance to operate on
+ *
+ * @return  true, if the device is ready for the next frame
+ * @return  false, if the device did not finish the frame within
+ *          @ref CONFIG_GNRC_NETIF_TRAIN_TX_TIMEOUT_MS
+ */
+static bool _await_tx_done(gnrc_netif_t *netif)
+{
+    ztimer_t timeout = { 0 };
+    bool expired = false;
+
+    _process_events(netif);
+    if (netif->tx_pkt == NULL) {
+        return true;
+    }
+    ztimer_set_timeout_flag(ZTIMER_MSEC, &timeout,
+                            CONFIG_GNRC_NETIF_TRAIN_TX_TIMEOUT_MS);
+    while ((netif->tx_pkt != NULL) && !expired) {
+        expired = thread_flags_wait_any(THREAD_FLAG_EVENT | THREAD_FLAG_TIMEOUT)
+                & THREAD_FLAG_TIMEOUT;
+        _process_events(netif);
+    }
+    ztimer_remove(ZTIMER_MSEC, &timeout);
+    thread_flags_clear(THREAD_FLAG_TIMEOUT);
+    return netif->tx_pkt == NULL;
+}
+#endif
+
 static void _send_queued_pkt(gnrc_netif_t *netif)
 {
     (void)netif;
@@ -1951,6 +2005,17 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+static void _wait_after_send(uint32_t *last_wakeup)
+{
+    ztimer_periodic_wakeup(ZTIMER_USEC, last_wakeup,
+                           CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+    /* override last_wakeup in case last_wakeup +
+     * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
+    *last_wakeup = ztimer_now(ZTIMER_USEC);
+}
+#endif
+
 static void *_gnrc_netif_thread(void *args)
 {
     _netif_ctx_t *ctx = args;
@@ -2009,16 +2074,31 @@ static void *_gnrc_netif_thread(void *args)
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(netif, msg.content.ptr, false);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
-                ztimer_periodic_wakeup(
-                        ZTIMER_USEC,
-                        &last_wakeup,
-                        CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
-                    );
-                /* override last_wakeup in case last_wakeup +
-                 * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
-                last_wakeup = ztimer_now(ZTIMER_USEC);
+                _wait_after_send(&last_wakeup);
 #endif
                 break;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SND_TRAIN received\n");
+                for (unsigned i = 0; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+#if IS_USED(MODULE_NETDEV_NEW_API)
+                    if (gnrc_netif_netdev_new_api(netif) && !_await_tx_done(netif)) {
+                        DEBUG("gnrc_netif: TX done timed out, dropping rest of train\n");
+                        for (; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+                            gnrc_pktbuf_release_error(
+                                gnrc_netapi_train_get(msg.content.ptr, i), ETIMEDOUT);
+                        }
+                        break;
+                    }
+#endif
+                    _send(netif, gnrc_netapi_train_get(msg.content.ptr, i), false);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+                    _wait_after_send(&last_wakeup);
+#endif
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
@@ -2068,6 +2148,12 @@ static void *_gnrc_netif_thread(void *args)
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_IPV6_FASTFWD)
+    /* forward plain unicast packets without involving the IPv6 thread */
+    if (gnrc_ipv6_fastfwd(pkt)) {
+        return;
+    }
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
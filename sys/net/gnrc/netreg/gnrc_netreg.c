@@ -31,8 +31,14 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+static_assert((CONFIG_GNRC_NETREG_HASH_BUCKETS > 0) &&
+              ((CONFIG_GNRC_NETREG_HASH_BUCKETS &
+                (CONFIG_GNRC_NETREG_HASH_BUCKETS - 1)) == 0),
+              "CONFIG_GNRC_NETREG_HASH_BUCKETS must be a power of 2");
+
+/* The registry as lookup table by gnrc_nettype_t and hash of the demux
+ * context */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][CONFIG_GNRC_NETREG_HASH_BUCKETS];
 
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
@@ -63,7 +69,16 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
+}
+
+static gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* fold all bytes of the demux context into the lowest, so protocol
+     * numbers, ports and GNRC_NETREG_DEMUX_CTX_ALL all spread */
+    demux_ctx ^= demux_ctx >> 16;
+    demux_ctx ^= demux_ctx >> 8;
+    return &netreg[type][demux_ctx & (CONFIG_GNRC_NETREG_HASH_BUCKETS - 1)];
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -132,8 +147,13 @@ static void _gnrc_netreg_release_exclusive(void) {
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
 #if DEVELHELP
-# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-    bool has_msg_q = (entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
+# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+     defined(MODULE_GNRC_NETAPI_TRAIN)
+    bool uses_pid = (entry->type == GNRC_NETREG_TYPE_DEFAULT);
+#  ifdef MODULE_GNRC_NETAPI_TRAIN
+    uses_pid |= (entry->type == GNRC_NETREG_TYPE_TRAIN);
+#  endif
+    bool has_msg_q = !uses_pid ||
                      thread_has_msg_queue(thread_get(entry->target.pid));
 # else
     bool has_msg_q = thread_has_msg_queue(thread_get(entry->target.pid));
@@ -154,12 +174,14 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     _gnrc_netreg_acquire_exclusive();
 
     /* don't add the same entry twice */
-    gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
-        assert(entry != e);
+    for (unsigned i = 0; i < CONFIG_GNRC_NETREG_HASH_BUCKETS; i++) {
+        gnrc_netreg_entry_t *e;
+        LL_FOREACH(netreg[type][i], e) {
+            assert(entry != e);
+        }
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*_bucket(type, entry->demux_ctx), entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +194,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +236,10 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        /* entries with the same demux context share a bucket, so the search
+         * for the next one can just continue in the list of from */
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <stdbool.h>
+
+#include "irq.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+
+#ifdef MODULE_GNRC_IPV6_BLACKLIST
+#include "net/gnrc/ipv6/blacklist.h"
+#endif
+#ifdef MODULE_GNRC_IPV6_WHITELIST
+#include "net/gnrc/ipv6/whitelist.h"
+#endif
+
+#include "net/gnrc/ipv6/fastfwd.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static bool _qualifies(const gnrc_pktsnip_t *pkt)
+{
+    const gnrc_pktsnip_t *netif_hdr = pkt->next;
+    const ipv6_hdr_t *hdr = pkt->data;
+
+    /* only take the packet if it is exclusively ours and consists of one
+     * IPv6 snip, so it can be modified in place */
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (pkt->users > 1) ||
+        (netif_hdr == NULL) || (netif_hdr->type != GNRC_NETTYPE_NETIF) ||
+        (netif_hdr->next != NULL) ||
+        (pkt->size < sizeof(ipv6_hdr_t)) || !ipv6_hdr_is(hdr)) {
+        return false;
+    }
+    /* others than the IPv6 thread want to see the packet as well */
+    if (gnrc_netreg_num(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL) > 1) {
+        return false;
+    }
+    /* hop limit would expire, ICMPv6 error required */
+    if (hdr->hl <= 1) {
+        return false;
+    }
+    /* Hop-by-Hop Options must be processed by each node on the path */
+    if (hdr->nh == PROTNUM_IPV6_EXT_HOPOPT) {
+        return false;
+    }
+    /* packet is malformed or carries a jumbogram */
+    if ((byteorder_ntohs(hdr->len) == 0) ||
+        (byteorder_ntohs(hdr->len) > (pkt->size - sizeof(ipv6_hdr_t)))) {
+        return false;
+    }
+    /* not forwarded at all or to more than one interface */
+    if (ipv6_addr_is_multicast(&hdr->dst) ||
+        ipv6_addr_is_link_local(&hdr->dst) ||
+        ipv6_addr_is_loopback(&hdr->dst) ||
+        ipv6_addr_is_unspecified(&hdr->dst) ||
+        ipv6_addr_is_link_local(&hdr->src)) {
+        return false;
+    }
+#ifdef MODULE_GNRC_IPV6_WHITELIST
+    if (!gnrc_ipv6_whitelisted(&hdr->src)) {
+        return false;
+    }
+#endif
+#ifdef MODULE_GNRC_IPV6_BLACKLIST
+    if (gnrc_ipv6_blacklisted(&hdr->src)) {
+        return false;
+    }
+#endif
+    /* packet is for this node */
+    if (gnrc_netif_get_by_ipv6_addr(&hdr->dst) != NULL) {
+        return false;
+    }
+
+    return true;
+}
+
+bool gnrc_ipv6_fastfwd(gnrc_pktsnip_t *pkt)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_pktsnip_t *ipv6, *netif_hdr;
+    gnrc_netif_t *netif;
+    ipv6_hdr_t *hdr = pkt->data;
+    unsigned len;
+
+    if (!_qualifies(pkt)) {
+        return false;
+    }
+    /* without packet, the NIB neither queues nor releases anything, so the
+     * IPv6 thread can retry e.g. if address resolution is required */
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(&hdr->dst, NULL, NULL, &nce) < 0) {
+        DEBUG("ipv6_fastfwd: next hop not resolved\n");
+        return false;
+    }
+    netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    len = sizeof(ipv6_hdr_t) + byteorder_ntohs(hdr->len);
+    if ((netif == NULL) || (len > netif->ipv6.mtu)) {
+        return false;
+    }
+    /* remove padding added by lower layers */
+    if (len < pkt->size) {
+        gnrc_pktbuf_realloc_data(pkt, len);
+    }
+    /* unless the packet buffer aligns to more than 8 bytes (e.g. the static
+     * one on 64-bit platforms), this does not copy the payload */
+    if ((ipv6 = gnrc_pktbuf_mark(pkt, sizeof(ipv6_hdr_t),
+                                 GNRC_NETTYPE_IPV6)) == NULL) {
+        return false;
+    }
+    pkt->type = GNRC_NETTYPE_UNDEF;
+    hdr = ipv6->data;
+    hdr->hl--;
+
+    netif_hdr = ipv6->next;
+#ifdef MODULE_NETSTATS_IPV6
+    gnrc_netif_t *in = gnrc_netif_hdr_get_netif(netif_hdr->data);
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    in->ipv6.stats.rx_count++;
+    in->ipv6.stats.rx_bytes += len;
+    netif->ipv6.stats.tx_unicast_count++;
+    netif->ipv6.stats.tx_success++;
+    netif->ipv6.stats.tx_bytes += len;
+    irq_restore(irq_state);
+#endif
+    gnrc_pktbuf_remove_snip(pkt, netif_hdr);
+    if ((pkt = gnrc_pktbuf_reverse_snips(pkt)) == NULL) {
+        DEBUG("ipv6_fastfwd: unable to reverse packet, dropping it\n");
+        return true;
+    }
+    if ((netif_hdr = gnrc_netif_hdr_build(NULL, 0, nce.l2addr,
+                                          nce.l2addr_len)) == NULL) {
+        DEBUG("ipv6_fastfwd: unable to allocate netif header, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, netif);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+
+    DEBUG("ipv6_fastfwd: forward packet over interface %" PRIkernel_pid "\n",
+          netif->pid);
+#ifdef MODULE_GNRC_SIXLOWPAN
+    if (gnrc_netif_is_6lo(netif)) {
+        if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                       GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+            DEBUG("ipv6_fastfwd: no 6LoWPAN thread found\n");
+            gnrc_pktbuf_release(pkt);
+        }
+        return true;
+    }
+#endif
+    if (gnrc_netif_send(netif, pkt) < 1) {
+        DEBUG("ipv6_fastfwd: unable to send packet\n");
+        gnrc_pktbuf_release(pkt);
+    }
+    return true;
+}
+
+/** @} */
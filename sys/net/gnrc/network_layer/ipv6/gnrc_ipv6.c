@@ -66,6 +66,45 @@ fib_table_t gnrc_ipv6_fib_table;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF > 0
+/**
+ * @brief   Destination cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination, unspecified if unused */
+    ipv6_addr_t src;            /**< selected source, unspecified if unknown */
+    gnrc_ipv6_nib_nc_t nce;     /**< neighbor cache entry of the next hop */
+    uint32_t gen;               /**< NIB generation the entry is valid for */
+    kernel_pid_t iface;         /**< interface requested by the sender */
+} _dst_cache_entry_t;
+
+/**
+ * @brief   Destination cache, most recently used entry first
+ *
+ * Only accessed by the IPv6 thread.
+ */
+static _dst_cache_entry_t _dst_cache[CONFIG_GNRC_IPV6_DST_CACHE_NUMOF];
+#endif
+
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+/**
+ * @brief   Maximum number of packets handed to an interface as one train
+ */
+#define GNRC_IPV6_TRAIN_LEN     (8U)
+
+/**
+ * @brief   Packets of a train to send that go out over the same interface
+ *
+ * Only accessed by the IPv6 thread.
+ */
+static struct {
+    gnrc_netif_t *netif;                        /**< interface of the packets */
+    gnrc_pktsnip_t *pkts[GNRC_IPV6_TRAIN_LEN];  /**< the packets */
+    uint8_t num;                                /**< number of packets */
+    bool collect;                               /**< currently sending a train */
+} _train;
+#endif
+
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
@@ -78,6 +117,10 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr);
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt);
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+/* handles GNRC_NETAPI_MSG_TYPE_SND_TRAIN commands */
+static void _send_train(gnrc_pktsnip_t *train);
+#endif
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
 
@@ -174,8 +217,8 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
-    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
-                                                            thread_getpid());
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_TRAIN(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              thread_getpid());
 
     (void)args;
     msg_init_queue(_msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -206,6 +249,13 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr, true);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND_TRAIN received\n");
+                _send_train(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("ipv6: reply to unsupported get/set\n");
@@ -259,6 +309,59 @@ static void *_event_loop(void *args)
     return NULL;
 }
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+static void _train_flush(void)
+{
+    gnrc_pktsnip_t *train = NULL;
+
+    if (_train.num > 1) {
+        train = gnrc_netapi_train_build(_train.pkts, _train.num);
+    }
+    if (train == NULL) {
+        /* single packet or packet buffer full: send packets one by one */
+        for (unsigned i = 0; i < _train.num; i++) {
+            if (gnrc_netif_send(_train.netif, _train.pkts[i]) < 1) {
+                DEBUG("ipv6: unable to send packet\n");
+                gnrc_pktbuf_release(_train.pkts[i]);
+            }
+        }
+    }
+    else if (gnrc_netapi_send_train(_train.netif->pid, train) < 1) {
+        DEBUG("ipv6: unable to send train\n");
+        for (unsigned i = 0; i < _train.num; i++) {
+            gnrc_pktbuf_release(_train.pkts[i]);
+        }
+        gnrc_pktbuf_release(train);
+    }
+    _train.num = 0;
+}
+
+static void _train_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    if ((_train.num > 0) &&
+        ((_train.netif != netif) || (_train.num == GNRC_IPV6_TRAIN_LEN))) {
+        _train_flush();
+    }
+    _train.netif = netif;
+    _train.pkts[_train.num++] = pkt;
+}
+
+static void _send_train(gnrc_pktsnip_t *train)
+{
+    /* packets for the same interface are collected by _send_to_iface() and
+     * handed down as a train again */
+    _train.collect = true;
+    for (unsigned i = 0; i < gnrc_netapi_train_len(train); i++) {
+        _send(gnrc_netapi_train_get(train, i), true);
+    }
+    _train.collect = false;
+    if (_train.num > 0) {
+        _train_flush();
+    }
+    gnrc_pktbuf_release(train);
+}
+#endif
+
 static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     const ipv6_hdr_t *hdr = pkt->next->data;
@@ -295,6 +398,12 @@ static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         }
         return;
     }
+#endif
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    if (_train.collect) {
+        _train_add(netif, pkt);
+        return;
+    }
 #endif
     if (gnrc_netif_send(netif, pkt) < 1) {
         DEBUG("ipv6: unable to send packet\n");
@@ -457,6 +566,65 @@ static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
     return true;
 }
 
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF > 0
+static _dst_cache_entry_t *_dst_cache_to_front(unsigned idx)
+{
+    if (idx > 0) {
+        _dst_cache_entry_t tmp = _dst_cache[idx];
+
+        memmove(&_dst_cache[1], &_dst_cache[0], idx * sizeof(tmp));
+        _dst_cache[0] = tmp;
+    }
+    return &_dst_cache[0];
+}
+
+static unsigned _dst_cache_idx(const ipv6_addr_t *dst, kernel_pid_t iface)
+{
+    unsigned idx;
+
+    for (idx = 0; idx < CONFIG_GNRC_IPV6_DST_CACHE_NUMOF; idx++) {
+        if ((_dst_cache[idx].iface == iface) &&
+            ipv6_addr_equal(&_dst_cache[idx].dst, dst)) {
+            break;
+        }
+    }
+    return idx;
+}
+
+static _dst_cache_entry_t *_dst_cache_get(const ipv6_addr_t *dst,
+                                          kernel_pid_t iface)
+{
+    unsigned idx = _dst_cache_idx(dst, iface);
+
+    if ((idx == CONFIG_GNRC_IPV6_DST_CACHE_NUMOF) ||
+        (_dst_cache[idx].gen != gnrc_ipv6_nib_gen())) {
+        return NULL;
+    }
+    return _dst_cache_to_front(idx);
+}
+
+static _dst_cache_entry_t *_dst_cache_add(const ipv6_addr_t *dst,
+                                          kernel_pid_t iface,
+                                          const gnrc_ipv6_nib_nc_t *nce,
+                                          uint32_t gen)
+{
+    unsigned idx = _dst_cache_idx(dst, iface);
+    _dst_cache_entry_t *entry;
+
+    /* replace the least recently used entry, if dst is not in the cache */
+    if (idx == CONFIG_GNRC_IPV6_DST_CACHE_NUMOF) {
+        idx--;
+    }
+    entry = _dst_cache_to_front(idx);
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    ipv6_addr_set_unspecified(&entry->src);
+    entry->nce = *nce;
+    entry->gen = gen;
+    entry->iface = iface;
+    return entry;
+}
+#endif  /* CONFIG_GNRC_IPV6_DST_CACHE_NUMOF > 0 */
+
 /* functions for sending */
 static bool _fragment_pkt_if_needed(gnrc_pktsnip_t *pkt,
                                     gnrc_netif_t *netif,
@@ -495,8 +663,28 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           uint8_t netif_hdr_flags)
 {
     gnrc_ipv6_nib_nc_t nce;
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF > 0
+    kernel_pid_t iface = (netif == NULL) ? KERNEL_PID_UNDEF : netif->pid;
+    bool select_src = prep_hdr && ipv6_addr_is_unspecified(&ipv6_hdr->src);
+    /* read before the look-ups, so changes during them are noticed */
+    uint32_t gen = gnrc_ipv6_nib_gen();
+    /* forwarded packets would only evict the entries of local flows */
+    _dst_cache_entry_t *dc = (prep_hdr) ? _dst_cache_get(&ipv6_hdr->dst, iface)
+                                        : NULL;
+#endif
 
     DEBUG("ipv6: send unicast\n");
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF > 0
+    if (dc != NULL) {
+        DEBUG("ipv6: take next hop from destination cache\n");
+        nce = dc->nce;
+        if (select_src) {
+            /* if still unspecified, _fill_ipv6_hdr() selects the source */
+            memcpy(&ipv6_hdr->src, &dc->src, sizeof(ipv6_hdr->src));
+        }
+    }
+    else
+#endif
     if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
                                           &nce) < 0) {
         /* packet is released by NIB */
@@ -507,6 +695,16 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
     if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF > 0
+        if (prep_hdr && (gnrc_ipv6_nib_gen() == gen)) {
+            if (dc == NULL) {
+                dc = _dst_cache_add(&ipv6_hdr->dst, iface, &nce, gen);
+            }
+            if (select_src) {
+                memcpy(&dc->src, &ipv6_hdr->src, sizeof(dc->src));
+            }
+        }
+#endif
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -19,6 +19,8 @@
 #include <string.h>
 #include <kernel_defines.h>
 
+#include "atomic_utils.h"
+#include "container.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -29,6 +31,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-lpm.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -47,14 +50,116 @@ static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0
+#if (CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF <= CONFIG_GNRC_IPV6_NIB_NUMOF) || \
+    (CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF & (CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF - 1))
+#error "CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF must be a power of two larger than CONFIG_GNRC_IPV6_NIB_NUMOF"
+#endif
+
+#define _HASH_MASK      (CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF - 1)
+
+#if CONFIG_GNRC_IPV6_NIB_NUMOF < UINT8_MAX
+typedef uint8_t _hash_slot_t;
+#define _HASH_FREE      (UINT8_MAX)
+#else
+typedef uint16_t _hash_slot_t;
+#define _HASH_FREE      (UINT16_MAX)
+#endif
+
+/* Indices into _nodes with linear probing. The interface is not part of the
+ * key, since _nib_onl_get() treats interface 0 as wildcard. Entries with the
+ * unspecified address are not indexed. */
+static _hash_slot_t _onl_hash[CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF];
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
+uint32_t _nib_gen;
 
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
+static void _set_node_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0
+unsigned _nib_onl_hash_slot(const ipv6_addr_t *addr)
+{
+    uint32_t hash = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(addr->u32); i++) {
+        hash = (hash ^ addr->u32[i].u32) * 0x9e3779b1U;
+    }
+    return (hash ^ (hash >> 16)) & _HASH_MASK;
+}
+
+static void _onl_hash_reset(void)
+{
+    memset(_onl_hash, 0xff, sizeof(_onl_hash));
+}
+
+static void _onl_hash_add(_nib_onl_entry_t *node)
+{
+    unsigned i;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    /* there are more slots than nodes, so this terminates */
+    for (i = _nib_onl_hash_slot(&node->ipv6); _onl_hash[i] != _HASH_FREE;
+         i = (i + 1) & _HASH_MASK) {}
+    _onl_hash[i] = node - _nodes;
+}
+
+void _nib_onl_hash_del(_nib_onl_entry_t *node)
+{
+    _hash_slot_t idx = node - _nodes;
+    unsigned hole;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (hole = _nib_onl_hash_slot(&node->ipv6); _onl_hash[hole] != idx;
+         hole = (hole + 1) & _HASH_MASK) {
+        if (_onl_hash[hole] == _HASH_FREE) {
+            /* not indexed */
+            return;
+        }
+    }
+    /* move later entries of the probe sequence into the hole, unless that
+     * would put them before their home slot */
+    for (unsigned i = (hole + 1) & _HASH_MASK; _onl_hash[i] != _HASH_FREE;
+         i = (i + 1) & _HASH_MASK) {
+        unsigned home = _nib_onl_hash_slot(&_nodes[_onl_hash[i]].ipv6);
+
+        if (((i - home) & _HASH_MASK) >= ((i - hole) & _HASH_MASK)) {
+            _onl_hash[hole] = _onl_hash[i];
+            hole = i;
+        }
+    }
+    _onl_hash[hole] = _HASH_FREE;
+}
+
+/* gets the next node with addr in the probe sequence, starting at *pos */
+static _nib_onl_entry_t *_onl_hash_next(const ipv6_addr_t *addr,
+                                        unsigned *pos)
+{
+    for (unsigned i = *pos; _onl_hash[i] != _HASH_FREE;
+         i = (i + 1) & _HASH_MASK) {
+        _nib_onl_entry_t *node = &_nodes[_onl_hash[i]];
+
+        if (ipv6_addr_equal(&node->ipv6, addr)) {
+            *pos = (i + 1) & _HASH_MASK;
+            return node;
+        }
+    }
+    return NULL;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+#define _onl_hash_reset()                           (void)0
+#define _onl_hash_add(node)                         (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -67,6 +172,8 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+    _nib_lpm_reset();
+    _onl_hash_reset();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -77,6 +184,14 @@ void _nib_acquire(void)
 }
 
 void _nib_release(void)
+{
+    /* advance before unlocking, so no one can read the new state with the
+     * old generation */
+    atomic_fetch_add_u32(&_nib_gen, 1);
+    rmutex_unlock(&_nib_mutex);
+}
+
+void _nib_release_unchanged(void)
 {
     rmutex_unlock(&_nib_mutex);
 }
@@ -98,6 +213,25 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        unsigned pos = _nib_onl_hash_slot(addr);
+        _nib_onl_entry_t *tmp;
+
+        while ((tmp = _onl_hash_next(addr, &pos)) != NULL) {
+            /* keep the first exact match in _nodes, as without the index */
+            if ((_nib_onl_get_if(tmp) == iface) &&
+                ((node == NULL) || (tmp < node))) {
+                node = tmp;
+            }
+        }
+        if (node != NULL) {
+            DEBUG("  %p is an exact match\n", (void *)node);
+            _override_node(addr, iface, node);
+            return node;
+        }
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -223,6 +357,23 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0
+    if (!ipv6_addr_is_unspecified(addr)) {
+        unsigned pos = _nib_onl_hash_slot(addr);
+        _nib_onl_entry_t *node, *res = NULL;
+
+        while ((node = _onl_hash_next(addr, &pos)) != NULL) {
+            if ((node->mode != _EMPTY) &&
+                ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+                 (_nib_onl_get_if(node) == iface)) &&
+                ((res == NULL) || (node < res))) {
+                res = node;
+            }
+        }
+        DEBUG("  Found %p\n", (void *)res);
+        return res;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -510,7 +661,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                 DEBUG("  %p is an exact match\n", (void *)tmp);
                 if (next_hop != NULL) {
                     /* sets next_hop if it was previously unspecified */
-                    memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _set_node_addr(tmp_node, next_hop);
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -526,8 +677,11 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         }
         _override_node(next_hop, iface, dst->next_hop);
         dst->next_hop->mode |= _DST;
+        /* entry may have been emptied without being cleared */
+        _nib_lpm_del(dst);
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_lpm_add(dst);
     }
     return dst;
 }
@@ -566,6 +720,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        _nib_lpm_del(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -596,11 +751,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
-
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _nib_lpm_get(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_len = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -613,14 +771,16 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            /* the longest matching prefix wins, not the most matching bits */
+            if ((entry->pfx_len > best_len) && (match >= entry->pfx_len)) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -880,11 +1040,18 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _set_node_addr(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
 
+static void _set_node_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+    _nib_onl_hash_del(node);
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    _onl_hash_add(node);
+}
+
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
 {
     switch (node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK) {
@@ -199,7 +199,7 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -221,6 +221,14 @@ typedef struct {
                                      valid (UINT32_MAX means forever) */
     uint32_t pref_until;        /**< timestamp (in ms) until which the prefix
                                      preferred (UINT32_MAX means forever) */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry with the same prefix in the prefix trie
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+     */
+    struct _nib_offl_entry *lpm_next;
+#endif
 } _nib_offl_entry_t;
 
 /**
@@ -251,6 +259,11 @@ typedef struct {
  */
 extern evtimer_msg_t _nib_evtimer;
 
+/**
+ * @brief   Generation of the NIB, see @ref gnrc_ipv6_nib_gen()
+ */
+extern uint32_t _nib_gen;
+
 /**
  * @brief   Primary default router.
  *
@@ -318,9 +331,20 @@ void _nib_acquire(void);
 
 /**
  * @brief   Release exclusive access to the NIB
+ *
+ * Also advances the [generation](@ref gnrc_ipv6_nib_gen()) of the NIB.
  */
 void _nib_release(void);
 
+/**
+ * @brief   Release exclusive access to the NIB without advancing its
+ *          generation
+ *
+ * Only to be used when neither the NIB nor the addresses of an interface
+ * were changed while holding the NIB.
+ */
+void _nib_release_unchanged(void);
+
 /**
  * @brief   Gets interface identifier from a NIB entry
  *
@@ -359,6 +383,31 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if (CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0) || defined(DOXYGEN)
+/**
+ * @brief   Gets the home slot of an address in the on-link hash index
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF
+ *
+ * @param[in] addr  An IPv6 address.
+ *
+ * @return  The slot at which the probe sequence for @p addr starts.
+ */
+unsigned _nib_onl_hash_slot(const ipv6_addr_t *addr);
+
+/**
+ * @brief   Removes an on-link entry from the hash index
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF
+ *
+ * Must be called before _nib_onl_entry_t::ipv6 of @p node is changed by other
+ * means than the functions in this header.
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_hash_del(_nib_onl_entry_t *node);
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+#define _nib_onl_hash_del(node)                     (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -370,6 +419,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_onl_hash_del(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <kernel_defines.h>
+#include <stdint.h>
+
+#include "_nib-lpm.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+
+/* Every node without entries has exactly two children, so there are at most
+ * N nodes with entries and N - 1 nodes without */
+#define _NODES_NUMOF    ((2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) - 1)
+
+#if _NODES_NUMOF < UINT8_MAX
+typedef uint8_t _lpm_idx_t;
+#define _NIL            (UINT8_MAX)
+#else
+typedef uint16_t _lpm_idx_t;
+#define _NIL            (UINT16_MAX)
+#endif
+
+typedef struct {
+    ipv6_addr_t pfx;                /* only the first len bits are valid */
+    _nib_offl_entry_t *entries;     /* entries with exactly this prefix */
+    _lpm_idx_t child[2];            /* by the bit following the prefix */
+    uint8_t len;
+} _lpm_node_t;
+
+static _lpm_node_t _trie[_NODES_NUMOF];
+static _lpm_idx_t _root = _NIL;
+/* unused nodes, linked by child[0] */
+static _lpm_idx_t _free = _NIL;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+/* length of the common prefix of a node and a prefix */
+static inline unsigned _common(const _lpm_node_t *node,
+                               const ipv6_addr_t *pfx, unsigned len)
+{
+    unsigned res = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+    if (res > node->len) {
+        res = node->len;
+    }
+    return (res > len) ? len : res;
+}
+
+static _lpm_idx_t _node_alloc(const ipv6_addr_t *pfx, unsigned len,
+                              _nib_offl_entry_t *entry)
+{
+    _lpm_idx_t idx = _free;
+
+    assert(idx != _NIL);
+    _lpm_node_t *node = &_trie[idx];
+
+    _free = node->child[0];
+    ipv6_addr_init_prefix(&node->pfx, pfx, len);
+    node->len = len;
+    node->entries = entry;
+    node->child[0] = _NIL;
+    node->child[1] = _NIL;
+    return idx;
+}
+
+static void _node_free(_lpm_idx_t idx)
+{
+    _trie[idx].child[0] = _free;
+    _free = idx;
+}
+
+/* removes the node in slot if it became redundant */
+static void _collapse(_lpm_idx_t *slot)
+{
+    _lpm_node_t *node = &_trie[*slot];
+    _lpm_idx_t idx = *slot;
+
+    if ((node->entries != NULL) ||
+        ((node->child[0] != _NIL) && (node->child[1] != _NIL))) {
+        return;
+    }
+    *slot = (node->child[0] != _NIL) ? node->child[0] : node->child[1];
+    _node_free(idx);
+}
+
+void _nib_lpm_reset(void)
+{
+    for (unsigned i = 0; i < _NODES_NUMOF; i++) {
+        _trie[i].child[0] = (i + 1 < _NODES_NUMOF) ? (i + 1) : _NIL;
+    }
+    _free = 0;
+    _root = _NIL;
+}
+
+void _nib_lpm_add(_nib_offl_entry_t *entry)
+{
+    const ipv6_addr_t *pfx = &entry->pfx;
+    unsigned len = entry->pfx_len;
+    _lpm_idx_t *slot = &_root;
+
+    entry->lpm_next = NULL;
+    while (*slot != _NIL) {
+        _lpm_node_t *node = &_trie[*slot];
+        unsigned common = _common(node, pfx, len);
+
+        if ((common == node->len) && (common == len)) {
+            /* keep entries in array order */
+            _nib_offl_entry_t **ptr = &node->entries;
+
+            while ((*ptr != NULL) && (*ptr < entry)) {
+                ptr = &(*ptr)->lpm_next;
+            }
+            entry->lpm_next = *ptr;
+            *ptr = entry;
+            return;
+        }
+        if (common == node->len) {
+            slot = &node->child[_bit(pfx, common)];
+            continue;
+        }
+        /* split: node gets a new parent */
+        _lpm_idx_t parent;
+
+        if (common == len) {
+            parent = _node_alloc(pfx, len, entry);
+        }
+        else {
+            parent = _node_alloc(pfx, common, NULL);
+            _trie[parent].child[_bit(pfx, common)] = _node_alloc(pfx, len,
+                                                                 entry);
+        }
+        _trie[parent].child[_bit(&node->pfx, common)] = *slot;
+        *slot = parent;
+        return;
+    }
+    *slot = _node_alloc(pfx, len, entry);
+}
+
+void _nib_lpm_del(_nib_offl_entry_t *entry)
+{
+    const ipv6_addr_t *pfx = &entry->pfx;
+    unsigned len = entry->pfx_len;
+    _lpm_idx_t *slot = &_root;
+    _lpm_idx_t *parent_slot = NULL;
+
+    while (*slot != _NIL) {
+        _lpm_node_t *node = &_trie[*slot];
+
+        if (_common(node, pfx, len) < node->len) {
+            return;
+        }
+        if (node->len == len) {
+            for (_nib_offl_entry_t **ptr = &node->entries; *ptr != NULL;
+                 ptr = &(*ptr)->lpm_next) {
+                if (*ptr == entry) {
+                    *ptr = entry->lpm_next;
+                    entry->lpm_next = NULL;
+                    _collapse(slot);
+                    /* parent may have had only this node and one other
+                     * child and no entries */
+                    if (parent_slot != NULL) {
+                        _collapse(parent_slot);
+                    }
+                    return;
+                }
+            }
+            return;
+        }
+        parent_slot = slot;
+        slot = &node->child[_bit(pfx, node->len)];
+    }
+}
+
+_nib_offl_entry_t *_nib_lpm_get(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    _lpm_idx_t idx = _root;
+
+    while (idx != _NIL) {
+        const _lpm_node_t *node = &_trie[idx];
+
+        if (ipv6_addr_match_prefix(&node->pfx, dst) < node->len) {
+            break;
+        }
+        /* deeper nodes have longer prefixes */
+        for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+             entry = entry->lpm_next) {
+            if (entry->mode != _EMPTY) {
+                DEBUG("nib: trie match with %u bits\n", node->len);
+                res = entry;
+                break;
+            }
+        }
+        if (node->len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        idx = node->child[_bit(dst, node->len)];
+    }
+    return res;
+}
+#else  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @{
+ *
+ * @file
+ * @brief   Prefix trie over the off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ *
+ * A path-compressed binary trie in static memory. Every node stores a prefix
+ * and, if any off-link entries have exactly that prefix, a list of them in
+ * the order of the off-link entry array.
+ */
+#ifndef PRIV_NIB_LPM_H
+#define PRIV_NIB_LPM_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Empties the trie
+ */
+void _nib_lpm_reset(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * @pre `entry` is not in the trie yet and its prefix is set
+ *
+ * @param[in] entry An off-link entry.
+ */
+void _nib_lpm_add(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * Does nothing if @p entry is not in the trie.
+ *
+ * @param[in] entry An off-link entry.
+ */
+void _nib_lpm_del(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching an address
+ *
+ * Entries with mode @ref _EMPTY are skipped. Of entries with the same prefix,
+ * the first in the off-link entry array is returned.
+ *
+ * @param[in] dst   An IPv6 address.
+ *
+ * @return  The best matching off-link entry.
+ * @return  NULL, if no off-link entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_lpm_get(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#define _nib_lpm_reset()                            (void)0
+#define _nib_lpm_add(entry)                         (void)entry
+#define _nib_lpm_del(entry)                         (void)entry
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_LPM_H */
+/** @} */
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 #include <kernel_defines.h>
 
+#include "atomic_utils.h"
 #include "log.h"
 #include "net/ipv6/addr.h"
 #include "net/gnrc/icmpv6/error.h"
@@ -112,6 +113,43 @@ static inline bool _should_search_rtr(const gnrc_netif_t *netif)
            (!gnrc_netif_is_rtr_adv(netif) || gnrc_netif_is_6ln(netif));
 }
 
+/* next hop resolution did not change the NIB and will not do so for
+ * further packets to the same destination */
+static inline bool _nce_settled(const gnrc_ipv6_nib_nc_t *nce)
+{
+    if (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)) {
+        return true;
+    }
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+            return true;
+        default:
+            /* neighbor unreachability detection needs to see packets */
+            return false;
+    }
+}
+
+static inline bool _route_notified(const gnrc_netif_t *netif)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    return (netif->ipv6.route_info_cb != NULL);
+#else
+    (void)netif;
+    return false;
+#endif
+}
+
+uint32_t gnrc_ipv6_nib_gen(void)
+{
+    return atomic_load_u32(&_nib_gen);
+}
+
+void gnrc_ipv6_nib_changed(void)
+{
+    atomic_fetch_add_u32(&_nib_gen, 1);
+}
+
 void gnrc_ipv6_nib_init(void)
 {
     evtimer_event_t *tmp;
@@ -282,8 +320,8 @@ static gnrc_netif_t *_acquire_new_iface(unsigned iface)
 {
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(iface);
     /* release NIB, in case other thread calls a NIB function while we wait for
-     * the netif */
-    _nib_release();
+     * the netif. Nothing was changed up to here. */
+    _nib_release_unchanged();
     gnrc_netif_acquire(netif);
     /* re-acquire NIB */
     _nib_acquire();
@@ -295,6 +333,7 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_ipv6_nib_nc_t *nce)
 {
     int res = 0;
+    bool changed = true;
 
     DEBUG("nib: get next hop link-layer address of %s%%%u\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
@@ -335,6 +374,7 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                 res = -EHOSTUNREACH;
                 break;
             }
+            changed = !_nce_settled(nce);
         }
         else {
             gnrc_ipv6_nib_ft_t route;
@@ -382,8 +422,11 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                     &route.dst,
                                     (void *)((intptr_t)route.dst_len));
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
+                /* only caches what was just resolved */
                 _nib_dc_add(&route.next_hop, netif->pid, dst);
 #endif  /* CONFIG_GNRC_IPV6_NIB_DC */
+                /* the routing protocol wants to see each use of the route */
+                changed = !_nce_settled(nce) || _route_notified(netif);
             }
             else {
                 /* _resolve_addr releases pkt if not queued (in which case
@@ -392,7 +435,12 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             }
         }
     } while (0);
-    _nib_release();
+    if (changed) {
+        _nib_release();
+    }
+    else {
+        _nib_release_unchanged();
+    }
     gnrc_netif_release(netif);
     return res;
 }
@@ -83,7 +83,7 @@ bool gnrc_ipv6_nib_abr_iter(void **state, gnrc_ipv6_nib_abr_t *entry)
             break;
         }
     }
-    _nib_release();
+    _nib_release_unchanged();
     *state = abr;
     return (*state != NULL);
 }
@@ -77,18 +77,29 @@ void gnrc_ipv6_nib_nc_del(const ipv6_addr_t *ipv6, unsigned iface)
 void gnrc_ipv6_nib_nc_mark_reachable(const ipv6_addr_t *ipv6)
 {
     _nib_onl_entry_t *node = NULL;
+    bool changed = false;
 
     _nib_acquire();
     while ((node = _nib_onl_iter(node)) != NULL) {
         if ((node->mode & _NC) && ipv6_addr_equal(ipv6, &node->ipv6)) {
+            uint16_t state = node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+
             /* only set reachable if not unmanaged */
-            if ((node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK)) {
+            if (state) {
+                /* restarting the reachable time of a reachable neighbor
+                 * does not change the results of look-ups */
+                changed = (state != GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
                 _nib_nc_set_reachable(node);
             }
             break;
         }
     }
-    _nib_release();
+    if (changed) {
+        _nib_release();
+    }
+    else {
+        _nib_release_unchanged();
+    }
 }
 
 bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
@@ -105,7 +116,7 @@ bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
         }
     }
     *state = node;
-    _nib_release();
+    _nib_release_unchanged();
     return (*state != NULL);
 }
 
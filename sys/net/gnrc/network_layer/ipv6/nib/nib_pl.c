@@ -139,7 +139,7 @@ bool gnrc_ipv6_nib_pl_iter(unsigned iface, void **state,
             break;
         }
     }
-    _nib_release();
+    _nib_release_unchanged();
     *state = dst;
     return (*state != NULL);
 }
@@ -0,0 +1,826 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with segregated size classes
+ *
+ * The arena is split into pools of fixed size blocks (bins). Free blocks of
+ * a bin are kept in a singly linked list, so allocating and freeing a block
+ * take constant time. An allocation is served by the smallest bin it fits
+ * in, or by the next larger one if that bin is exhausted.
+ *
+ * @ref gnrc_pktbuf_mark() splits the data of a snip into two snips sharing
+ * the same block, so every block has a reference count. The block is only
+ * returned to its bin when all snips pointing into it have been freed.
+ *
+ * With `gnrc_pktbuf_cache`, free blocks are additionally kept in per-thread
+ * caches. Only its thread (never interrupt context) takes blocks from a
+ * cache, so @ref gnrc_pktbuf_add() can do so without the mutex, interrupts
+ * are disabled for a few instructions instead. Blocks in a cache count as
+ * used for their bin, are not referenced (reference count 0) and are moved
+ * between bin and cache in batches while the mutex is held anyway.
+ *
+ * A cache whose thread has exited is drained and handed to the next thread
+ * claiming one. Before an allocation fails, all caches are drained, so no
+ * block is stranded in a cache.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "thread.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SMALL_BYTES     (CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE * \
+                         CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF)
+#define FRAME_BYTES     (CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE * \
+                         CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF)
+#define MTU_BYTES       (CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE * \
+                         CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF)
+#define BLOCKS_NUMOF    (CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF + \
+                         CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF + \
+                         CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF)
+
+static_assert((CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE % 8) == 0 &&
+              (CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE % 8) == 0 &&
+              (CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE % 8) == 0,
+              "block sizes of gnrc_pktbuf_bins have to be multiples of 8");
+static_assert(CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE >= sizeof(gnrc_pktsnip_t),
+              "small blocks of gnrc_pktbuf_bins must fit a packet snip");
+static_assert((CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE <
+               CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE) &&
+              (CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE <
+               CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE),
+              "block sizes of gnrc_pktbuf_bins have to be increasing");
+static_assert(BLOCKS_NUMOF <= UINT16_MAX, "too many blocks");
+
+/**
+ * @brief   Free block, only valid while the block is in its bin
+ */
+typedef struct _free {
+    struct _free *next;     /**< next free block of the same bin */
+} _free_t;
+
+/**
+ * @brief   Bin of equally sized blocks
+ */
+typedef struct {
+    uint8_t *start;         /**< first block */
+    _free_t *free;          /**< list of free blocks */
+    size_t bytes;           /**< bytes requested by the allocated blocks */
+    uint16_t size;          /**< block size */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t first;         /**< index of the first block in _refs */
+    uint16_t used;          /**< number of allocated blocks */
+    uint16_t max_used;      /**< maximum of @ref used */
+    uint16_t fallbacks;     /**< requests served by a larger bin */
+    uint16_t fails;         /**< requests that could not be served */
+} _bin_t;
+
+static alignas(8) uint8_t _arena[SMALL_BYTES + FRAME_BYTES + MTU_BYTES];
+static uint8_t _refs[BLOCKS_NUMOF];
+static _bin_t _bins[] = {
+    {
+        .start = _arena,
+        .size = CONFIG_GNRC_PKTBUF_BINS_SMALL_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF,
+        .first = 0,
+    },
+    {
+        .start = _arena + SMALL_BYTES,
+        .size = CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF,
+    },
+    {
+        .start = _arena + SMALL_BYTES + FRAME_BYTES,
+        .size = CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_BINS_SMALL_NUMOF +
+                 CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF,
+    },
+};
+
+#if IS_USED(MODULE_GNRC_PKTBUF_CACHE)
+/**
+ * @brief   Per-thread cache of free blocks
+ */
+typedef struct {
+    void *blocks[ARRAY_SIZE(_bins)][CONFIG_GNRC_PKTBUF_CACHE_SIZE]; /**< stacks of free blocks */
+    size_t bytes[ARRAY_SIZE(_bins)];    /**< bytes requested from this cache */
+    const thread_t *owner;              /**< thread of the cache, NULL if free */
+    kernel_pid_t pid;                   /**< PID of @ref owner */
+    uint8_t numof[ARRAY_SIZE(_bins)];   /**< number of blocks in the stacks */
+} _cache_t;
+
+static _cache_t _caches[CONFIG_GNRC_PKTBUF_CACHE_NUMOF];
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline void _push(_bin_t *bin, uint8_t *block)
+{
+    /* blocks are 8 byte aligned, cast via uintptr_t to silence -Wcast-align */
+    _free_t *entry = (_free_t *)(uintptr_t)block;
+
+    entry->next = bin->free;
+    bin->free = entry;
+}
+
+/* returns the bin containing ptr and the index of its block in _refs */
+static _bin_t *_find(const void *ptr, unsigned *idx)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        _bin_t *bin = &_bins[i];
+        size_t offset = (const uint8_t *)ptr - bin->start;
+
+        if (offset < (size_t)bin->size * bin->numof) {
+            *idx = bin->first + offset / bin->size;
+            return bin;
+        }
+    }
+
+    return NULL;
+}
+
+static uint8_t *_block_start(const _bin_t *bin, unsigned idx)
+{
+    return bin->start + (size_t)(idx - bin->first) * bin->size;
+}
+
+#if IS_USED(MODULE_GNRC_PKTBUF_CACHE)
+static inline unsigned _cache_max(const _bin_t *bin)
+{
+    unsigned max = bin->numof / (CONFIG_GNRC_PKTBUF_CACHE_NUMOF + 1);
+
+    return (max < CONFIG_GNRC_PKTBUF_CACHE_SIZE) ? max : CONFIG_GNRC_PKTBUF_CACHE_SIZE;
+}
+
+static _cache_t *_cache_get(void)
+{
+    if (irq_is_in()) {
+        return NULL;
+    }
+
+    const thread_t *me = thread_get_active();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_caches); i++) {
+        if (_caches[i].owner == me) {
+            return &_caches[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* returns all blocks of the cache to their bins and the number of blocks,
+ * gnrc_pktbuf_mutex must be held */
+static unsigned _cache_drain(_cache_t *cache)
+{
+    unsigned drained = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        _bin_t *bin = &_bins[i];
+        /* the owner takes blocks from its cache without the mutex */
+        unsigned state = irq_disable();
+
+        while (cache->numof[i] > 0) {
+            _push(bin, cache->blocks[i][--cache->numof[i]]);
+            bin->used--;
+            drained++;
+        }
+        bin->bytes += cache->bytes[i];
+        cache->bytes[i] = 0;
+        irq_restore(state);
+    }
+
+    return drained;
+}
+
+/* binds a cache to the calling thread, gnrc_pktbuf_mutex must be held */
+static _cache_t *_cache_claim(void)
+{
+    _cache_t *cache = _cache_get();
+
+    if ((cache != NULL) || irq_is_in()) {
+        return cache;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_caches); i++) {
+        _cache_t *c = &_caches[i];
+
+        /* the thread of the cache has exited, its PID may have been reused */
+        if ((c->owner != NULL) &&
+            (thread_get_unchecked(c->pid) != c->owner)) {
+            _cache_drain(c);
+            c->owner = NULL;
+        }
+        if (c->owner == NULL) {
+            c->owner = thread_get_active();
+            c->pid = thread_getpid();
+            return c;
+        }
+    }
+
+    return NULL;
+}
+
+/* returns the blocks of all caches to their bins,
+ * gnrc_pktbuf_mutex must be held */
+static bool _cache_drain_all(void)
+{
+    unsigned drained = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_caches); i++) {
+        drained += _cache_drain(&_caches[i]);
+    }
+
+    return drained > 0;
+}
+
+static inline unsigned _cache_cached(const _bin_t *bin)
+{
+    unsigned numof = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_caches); i++) {
+        numof += _caches[i].numof[bin - _bins];
+    }
+
+    return numof;
+}
+
+static inline size_t _cache_bytes(const _bin_t *bin)
+{
+    size_t bytes = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_caches); i++) {
+        bytes += _caches[i].bytes[bin - _bins];
+    }
+
+    return bytes;
+}
+
+/* takes a block of the best fitting bin from the cache of the calling
+ * thread, does not need gnrc_pktbuf_mutex */
+static void *_cache_pop(size_t size)
+{
+    _cache_t *cache = _cache_get();
+
+    if (cache == NULL) {
+        return NULL;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        _bin_t *bin = &_bins[i];
+
+        if (size > bin->size) {
+            continue;
+        }
+
+        /* another thread may drain the cache while holding the mutex */
+        unsigned state = irq_disable();
+
+        if (cache->numof[i] == 0) {
+            irq_restore(state);
+            return NULL;
+        }
+
+        uint8_t *block = cache->blocks[i][--cache->numof[i]];
+
+        _refs[bin->first + (block - bin->start) / bin->size] = 1;
+        cache->bytes[i] += size;
+        irq_restore(state);
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(block, ~GNRC_PKTBUF_CANARY, bin->size);
+        }
+        return block;
+    }
+
+    return NULL;
+}
+
+/* fills the cache of the calling thread from the bin,
+ * gnrc_pktbuf_mutex must be held */
+static void _cache_refill(_bin_t *bin)
+{
+    _cache_t *cache = _cache_claim();
+    unsigned i = bin - _bins;
+    unsigned max = _cache_max(bin);
+
+    if (cache == NULL) {
+        return;
+    }
+    while ((bin->free != NULL) && (cache->numof[i] < max)) {
+        cache->blocks[i][cache->numof[i]++] = bin->free;
+        bin->free = bin->free->next;
+        if (++bin->used > bin->max_used) {
+            bin->max_used = bin->used;
+        }
+    }
+}
+
+/* puts an unreferenced block into the cache of the calling thread,
+ * gnrc_pktbuf_mutex must be held */
+static bool _cache_put(_bin_t *bin, uint8_t *block)
+{
+    _cache_t *cache = _cache_get();
+    unsigned i = bin - _bins;
+
+    if ((cache == NULL) || (cache->numof[i] >= _cache_max(bin))) {
+        return false;
+    }
+    cache->blocks[i][cache->numof[i]++] = block;
+
+    return true;
+}
+#else
+static inline unsigned _cache_cached(const _bin_t *bin)
+{
+    (void)bin;
+    return 0;
+}
+
+static inline size_t _cache_bytes(const _bin_t *bin)
+{
+    (void)bin;
+    return 0;
+}
+
+static inline void *_cache_pop(size_t size)
+{
+    (void)size;
+    return NULL;
+}
+
+static inline bool _cache_drain_all(void)
+{
+    return false;
+}
+
+static inline void _cache_refill(_bin_t *bin)
+{
+    (void)bin;
+}
+
+static inline bool _cache_put(_bin_t *bin, uint8_t *block)
+{
+    (void)bin;
+    (void)block;
+    return false;
+}
+#endif
+
+/* gnrc_pktbuf_mutex must be held */
+static void *_pktbuf_alloc(size_t size)
+{
+    _bin_t *best = NULL;
+    void *block = _cache_pop(size);
+
+    if (block != NULL) {
+        return block;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        _bin_t *bin = &_bins[i];
+
+        if (size > bin->size) {
+            continue;
+        }
+        if (best == NULL) {
+            best = bin;
+            _cache_refill(bin);
+            block = _cache_pop(size);
+            if (block != NULL) {
+                return block;
+            }
+        }
+        if (bin->free == NULL) {
+            continue;
+        }
+
+        block = bin->free;
+        bin->free = bin->free->next;
+        _refs[bin->first + ((uint8_t *)block - bin->start) / bin->size] = 1;
+        bin->bytes += size;
+        if (++bin->used > bin->max_used) {
+            bin->max_used = bin->used;
+        }
+        if (bin != best) {
+            best->fallbacks++;
+        }
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(block, ~GNRC_PKTBUF_CANARY, bin->size);
+        }
+        return block;
+    }
+
+    if (_cache_drain_all()) {
+        /* blocks were held in caches, the bins can serve the request now or
+         * the caches stay empty, so this recurses at most once */
+        return _pktbuf_alloc(size);
+    }
+
+    DEBUG("pktbuf: no block left for %" PRIuSIZE " bytes\n", size);
+    if (best == NULL) {
+        best = &_bins[ARRAY_SIZE(_bins) - 1];
+    }
+    best->fails++;
+
+    return NULL;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_arena, GNRC_PKTBUF_CANARY, sizeof(_arena));
+    }
+    memset(_refs, 0, sizeof(_refs));
+#if IS_USED(MODULE_GNRC_PKTBUF_CACHE)
+    memset(_caches, 0, sizeof(_caches));
+#endif
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        _bin_t *bin = &_bins[i];
+
+        bin->free = NULL;
+        bin->bytes = 0;
+        bin->used = 0;
+        bin->max_used = 0;
+        bin->fallbacks = 0;
+        bin->fails = 0;
+        /* push in reverse, so the lowest block is handed out first */
+        for (unsigned j = bin->numof; j > 0; j--) {
+            _push(bin, bin->start + (size_t)(j - 1) * bin->size);
+        }
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+    void *_data = NULL;
+
+    if (size > CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE (%u)\n",
+              size, CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE);
+        mutex_lock(&gnrc_pktbuf_mutex);
+        _bins[ARRAY_SIZE(_bins) - 1].fails++;
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* try the cache of this thread first, only lock if that fails */
+    pkt = _cache_pop(sizeof(gnrc_pktsnip_t));
+    if ((pkt != NULL) && (size > 0)) {
+        _data = _cache_pop(size);
+    }
+    if ((pkt == NULL) || ((size > 0) && (_data == NULL))) {
+        mutex_lock(&gnrc_pktbuf_mutex);
+        if (pkt == NULL) {
+            pkt = _create_snip(next, data, size, type);
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return pkt;
+        }
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+    }
+    if ((data != NULL) && (size > 0)) {
+        memcpy(_data, data, size);
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size == size) {
+        pkt->data = NULL;
+    }
+    else {
+        unsigned idx;
+
+        /* both snips point into the same block now */
+        _find(pkt->data, &idx);
+        assert(_refs[idx] < UINT8_MAX);
+        _refs[idx]++;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    else if (pkt->data == NULL) {
+        pkt->data = _pktbuf_alloc(size);
+        if (pkt->data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+    }
+    else {
+        unsigned idx;
+        _bin_t *bin = _find(pkt->data, &idx);
+        size_t offset = (uint8_t *)pkt->data - _block_start(bin, idx);
+
+        /* shrinking always works in place, growing only if the block is not
+         * shared and has enough room behind the data */
+        if ((size < pkt->size) ||
+            ((_refs[idx] == 1) && (offset + size <= bin->size))) {
+            bin->bytes = bin->bytes - pkt->size + size;
+        }
+        else {
+            void *new_data = _pktbuf_alloc(size);
+
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&gnrc_pktbuf_mutex);
+                return ENOMEM;
+            }
+            memcpy(new_data, pkt->data, pkt->size);
+            gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+            pkt->data = new_data;
+        }
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        assert(pkt->users + num <= 0xff);
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        pkt->users == GNRC_PKTBUF_CANARY) {
+        puts("gnrc_pktbuf: use after free detected\n");
+        DEBUG_BREAKPOINT(3);
+    }
+
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+size_t gnrc_pktbuf_free_bytes(void)
+{
+    size_t bytes = 0;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        const _bin_t *bin = &_bins[i];
+
+        /* cached blocks count as used, but are free for allocation */
+        bytes += (size_t)(bin->numof - bin->used + _cache_cached(bin)) *
+                 bin->size;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return bytes;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_arena[0], (void *)&_arena[sizeof(_arena)],
+           (unsigned)sizeof(_arena));
+    puts("   size  blocks  used  cached  max  wasted  fallbacks  fails");
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        const _bin_t *bin = &_bins[i];
+        unsigned cached = _cache_cached(bin);
+        /* internal fragmentation: bytes of allocated blocks not requested,
+         * the bytes of cache allocations are released to the bin */
+        size_t wasted = (size_t)(bin->used - cached) * bin->size -
+                        (bin->bytes + _cache_bytes(bin));
+
+        printf("  %5u  %6u  %4u  %6u  %3u  %6u  %9u  %5u\n",
+               bin->size, bin->numof, bin->used - cached, cached,
+               bin->max_used, (unsigned)wasted, bin->fallbacks, bin->fails);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        if (_bins[i].used != _cache_cached(&_bins[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - every free block lies on a block boundary of its bin and is not
+     *    referenced
+     *  - free blocks + used blocks == blocks of the bin
+     *  - cached blocks are not referenced either */
+    for (unsigned i = 0; i < ARRAY_SIZE(_bins); i++) {
+        const _bin_t *bin = &_bins[i];
+        unsigned numof = 0;
+
+        for (_free_t *ptr = bin->free; ptr != NULL; ptr = ptr->next) {
+            unsigned idx;
+
+            if ((_find(ptr, &idx) != bin) ||
+                ((uint8_t *)ptr != _block_start(bin, idx)) ||
+                (_refs[idx] != 0) || (++numof > bin->numof)) {
+                return false;
+            }
+        }
+        if (numof + bin->used != bin->numof) {
+            return false;
+        }
+#if IS_USED(MODULE_GNRC_PKTBUF_CACHE)
+        for (unsigned j = 0; j < ARRAY_SIZE(_caches); j++) {
+            for (unsigned k = 0; k < _caches[j].numof[i]; k++) {
+                unsigned idx;
+
+                if ((_find(_caches[j].blocks[i][k], &idx) != bin) ||
+                    (_refs[idx] != 0)) {
+                    return false;
+                }
+            }
+        }
+#endif
+    }
+
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    unsigned idx;
+    _bin_t *bin;
+
+    if (data == NULL) {
+        return;
+    }
+
+    bin = _find(data, &idx);
+    if (bin == NULL) {
+        assert(0);
+        return;
+    }
+    assert(_refs[idx] > 0);
+    bin->bytes -= size;
+    if (--_refs[idx] == 0) {
+        uint8_t *block = _block_start(bin, idx);
+
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(block, GNRC_PKTBUF_CANARY, bin->size);
+        }
+        if (!_cache_put(bin, block)) {
+            _push(bin, block);
+            bin->used--;
+        }
+    }
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_arena;
+    const uintptr_t end = start + sizeof(_arena);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/** @} */
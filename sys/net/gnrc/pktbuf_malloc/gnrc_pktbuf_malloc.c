@@ -19,6 +19,7 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -237,6 +238,12 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
     return pkt;
 }
 
+size_t gnrc_pktbuf_free_bytes(void)
+{
+    /* only limited by the heap */
+    return SIZE_MAX;
+}
+
 #ifdef DEVELHELP
 void gnrc_pktbuf_stats(void)
 {
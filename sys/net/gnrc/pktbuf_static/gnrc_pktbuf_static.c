@@ -238,6 +238,18 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
     return pkt;
 }
 
+size_t gnrc_pktbuf_free_bytes(void)
+{
+    size_t bytes = 0;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+        bytes += ptr->size;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return bytes;
+}
+
 #ifdef DEVELHELP
 static inline void _print_chunk(void *chunk, size_t size, int num)
 {
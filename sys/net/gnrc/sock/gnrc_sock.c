@@ -76,13 +76,63 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     gnrc_netreg_register(type, &reg->entry);
 }
 
-ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
-                       uint32_t timeout, sock_ip_ep_t *remote,
-                       gnrc_sock_recv_aux_t *aux)
+static ssize_t _recv_msg(const msg_t *msg, gnrc_pktsnip_t **pkt_out,
+                         sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux)
 {
     /* only used when some sock_aux_% module is used */
     (void)aux;
     gnrc_pktsnip_t *pkt, *netif;
+
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            pkt = msg->content.ptr;
+            break;
+        default:
+            return -EINVAL;
+    }
+    /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
+     * was implemented */
+    ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
+    assert(ipv6_hdr != NULL);
+    memcpy(&remote->addr, &ipv6_hdr->src, sizeof(ipv6_addr_t));
+    remote->family = AF_INET6;
+#if IS_USED(MODULE_SOCK_AUX_LOCAL)
+    if (aux->local != NULL) {
+        memcpy(&aux->local->addr, &ipv6_hdr->dst, sizeof(ipv6_addr_t));
+        aux->local->family = AF_INET6;
+    }
+#endif /* MODULE_SOCK_AUX_LOCAL */
+    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif == NULL) {
+        remote->netif = SOCK_ADDR_ANY_NETIF;
+    }
+    else {
+        gnrc_netif_hdr_t *netif_hdr = netif->data;
+        /* TODO: use API in #5511 */
+        remote->netif = (uint16_t)netif_hdr->if_pid;
+#if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
+        if (aux->timestamp != NULL) {
+            if (gnrc_netif_hdr_get_timestamp(netif_hdr, aux->timestamp) == 0) {
+                aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_TIMESTAMP;
+            }
+        }
+#endif /* MODULE_SOCK_AUX_TIMESTAMP */
+#if IS_USED(MODULE_SOCK_AUX_RSSI)
+        if ((aux->rssi) && (netif_hdr->rssi != GNRC_NETIF_HDR_NO_RSSI)) {
+            aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_RSSI;
+            *aux->rssi = netif_hdr->rssi;
+        }
+#endif /* MODULE_SOCK_AUX_RSSI */
+    }
+    *pkt_out = pkt; /* set out parameter */
+    return 0;
+}
+
+ssize_t gnrc_sock_recv_wait(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
+                            uint32_t timeout, sock_ip_ep_t *remote,
+                            gnrc_sock_recv_aux_t *aux)
+{
+    ssize_t res;
     msg_t msg;
 
     /* The fuzzing module is only enabled when building a fuzzing
@@ -142,110 +192,88 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
             return -ENOTSUP;
         }
     }
-    switch (msg.type) {
-        case GNRC_NETAPI_MSG_TYPE_RCV:
-            pkt = msg.content.ptr;
-            break;
-        default:
-            return -EINVAL;
-    }
-    /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
-     * was implemented */
-    ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
-    assert(ipv6_hdr != NULL);
-    memcpy(&remote->addr, &ipv6_hdr->src, sizeof(ipv6_addr_t));
-    remote->family = AF_INET6;
-#if IS_USED(MODULE_SOCK_AUX_LOCAL)
-    if (aux->local != NULL) {
-        memcpy(&aux->local->addr, &ipv6_hdr->dst, sizeof(ipv6_addr_t));
-        aux->local->family = AF_INET6;
-    }
-#endif /* MODULE_SOCK_AUX_LOCAL */
-    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
-    if (netif == NULL) {
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-    }
-    else {
-        gnrc_netif_hdr_t *netif_hdr = netif->data;
-        /* TODO: use API in #5511 */
-        remote->netif = (uint16_t)netif_hdr->if_pid;
-#if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
-        if (aux->timestamp != NULL) {
-            if (gnrc_netif_hdr_get_timestamp(netif_hdr, aux->timestamp) == 0) {
-                aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_TIMESTAMP;
-            }
-        }
-#endif /* MODULE_SOCK_AUX_TIMESTAMP */
-#if IS_USED(MODULE_SOCK_AUX_RSSI)
-        if ((aux->rssi) && (netif_hdr->rssi != GNRC_NETIF_HDR_NO_RSSI)) {
-            aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_RSSI;
-            *aux->rssi = netif_hdr->rssi;
-        }
-#endif /* MODULE_SOCK_AUX_RSSI */
+    res = _recv_msg(&msg, pkt_out, remote, aux);
+    if (res < 0) {
+        return res;
     }
-    *pkt_out = pkt; /* set out parameter */
+#ifdef MODULE_FUZZING
+    gnrc_sock_prevpkt = *pkt_out;
+#endif
 
+    return 0;
+}
+
+void gnrc_sock_recv_notify(gnrc_sock_reg_t *reg)
+{
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
     if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
         reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
     }
+#else
+    (void)reg;
 #endif
-#ifdef MODULE_FUZZING
-    gnrc_sock_prevpkt = pkt;
-#endif
+}
 
-    return 0;
+ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
+                       uint32_t timeout, sock_ip_ep_t *remote,
+                       gnrc_sock_recv_aux_t *aux)
+{
+    ssize_t res = gnrc_sock_recv_wait(reg, pkt_out, timeout, remote, aux);
+
+    if (res == 0) {
+        gnrc_sock_recv_notify(reg);
+    }
+    return res;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+ssize_t gnrc_sock_recv_queued(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
+                              sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux)
+{
+    msg_t msg;
+
+    if (!mbox_try_get(&reg->mbox, &msg)) {
+        return -EAGAIN;
+    }
+    return _recv_msg(&msg, pkt_out, remote, aux);
+}
+
+int gnrc_sock_build(gnrc_pktsnip_t **pkt, gnrc_nettype_t *type,
+                    const sock_ip_ep_t *local, const sock_ip_ep_t *remote,
+                    uint8_t nh)
 {
-    gnrc_pktsnip_t *pkt;
+    gnrc_pktsnip_t *payload = *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
-    gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
-#ifdef MODULE_GNRC_NETERR
-    unsigned status_subs = 0;
-#endif
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    gnrc_tx_sync_t tx_sync;
-#endif
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
         return -EAFNOSUPPORT;
     }
 
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
-        gnrc_pktbuf_release(payload);
-        return -ENOMEM;
-    }
-#endif
-
     switch (local->family) {
 #ifdef SOCK_HAS_IPV6
         case AF_INET6: {
             ipv6_hdr_t *hdr;
-            pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
-                                      (ipv6_addr_t *)&remote->addr.ipv6);
-            if (pkt == NULL) {
+            *pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
+                                       (ipv6_addr_t *)&remote->addr.ipv6);
+            if (*pkt == NULL) {
+                gnrc_pktbuf_release(payload);
                 return -ENOMEM;
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
-                type = GNRC_NETTYPE_IPV6;
+                *type = GNRC_NETTYPE_IPV6;
             }
             else {
-                type = payload->type;
+                *type = payload->type;
             }
-            hdr = pkt->data;
+            hdr = (*pkt)->data;
             hdr->nh = nh;
             break;
         }
 #endif
         default:
             (void)nh;
+            (void)type;
             gnrc_pktbuf_release(payload);
             return -EAFNOSUPPORT;
     }
@@ -262,12 +290,37 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         gnrc_netif_hdr_t *netif_hdr;
 
         if (netif == NULL) {
-            gnrc_pktbuf_release(pkt);
+            gnrc_pktbuf_release(*pkt);
             return -ENOMEM;
         }
         netif_hdr = netif->data;
         netif_hdr->if_pid = iface;
-        pkt = gnrc_pkt_prepend(pkt, netif);
+        *pkt = gnrc_pkt_prepend(*pkt, netif);
+    }
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt = payload;
+    gnrc_nettype_t type;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int err;
+#ifdef MODULE_GNRC_NETERR
+    unsigned status_subs = 0;
+#endif
+#if IS_USED(MODULE_GNRC_TX_SYNC)
+    gnrc_tx_sync_t tx_sync;
+
+    if (gnrc_tx_sync_append(payload, &tx_sync)) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+#endif
+
+    if ((err = gnrc_sock_build(&pkt, &type, local, remote, nh)) < 0) {
+        return err;
     }
 #ifdef MODULE_GNRC_NETERR
     /* cppcheck-suppress uninitvar
@@ -158,6 +158,48 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux);
 
+/**
+ * @brief   Receive a packet internally without notifying the asynchronous
+ *          callback about packets still queued
+ * @internal
+ *
+ * For callers that drain the queue afterwards and call
+ * @ref gnrc_sock_recv_notify() when done.
+ */
+ssize_t gnrc_sock_recv_wait(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt,
+                            uint32_t timeout, sock_ip_ep_t *remote,
+                            gnrc_sock_recv_aux_t *aux);
+
+/**
+ * @brief   Notify the asynchronous callback, if packets are still queued
+ * @internal
+ */
+void gnrc_sock_recv_notify(gnrc_sock_reg_t *reg);
+
+/**
+ * @brief   Take a packet already queued at a sock internally
+ * @internal
+ *
+ * Does neither wait nor notify the asynchronous callback, for callers that
+ * drain the queue after @ref gnrc_sock_recv_wait() returned.
+ *
+ * @return  -EAGAIN, if no packet is queued.
+ */
+ssize_t gnrc_sock_recv_queued(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt,
+                              sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux);
+
+/**
+ * @brief   Prepend network layer and interface header to a packet internally
+ * @internal
+ *
+ * @param[in,out] pkt   The payload, the complete packet on return. Released
+ *                      on error.
+ * @param[out] type     The type to dispatch the packet to.
+ */
+int gnrc_sock_build(gnrc_pktsnip_t **pkt, gnrc_nettype_t *type,
+                    const sock_ip_ep_t *local, const sock_ip_ep_t *remote,
+                    uint8_t nh);
+
 /**
  * @brief   Send a packet internally
  * @internal
@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "byteorder.h"
+#include "container.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -239,56 +240,47 @@ static bool _accept_remote(const sock_udp_t *sock, const udp_hdr_t *hdr,
     return true;
 }
 
-ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
-                              uint32_t timeout, sock_udp_ep_t *remote,
-                              sock_udp_aux_rx_t *aux)
+static void _aux_setup(gnrc_sock_recv_aux_t *_aux, sock_udp_aux_rx_t *aux)
 {
+    (void)_aux;
     (void)aux;
-    gnrc_pktsnip_t *pkt, *udp;
-    udp_hdr_t *hdr;
-    sock_ip_ep_t tmp;
-    int res;
-    gnrc_sock_recv_aux_t _aux = { 0 };
-
-    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
-    if (*buf_ctx != NULL) {
-        *data = NULL;
-        gnrc_pktbuf_release(*buf_ctx);
-        *buf_ctx = NULL;
-        return 0;
-    }
-    if (sock->local.family == AF_UNSPEC) {
-        return -EADDRNOTAVAIL;
-    }
-    tmp.family = sock->local.family;
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     if ((aux != NULL) && (aux->flags & SOCK_AUX_GET_LOCAL)) {
-        _aux.local = (sock_ip_ep_t *)&aux->local;
+        _aux->local = (sock_ip_ep_t *)&aux->local;
     }
 #endif
 #if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
     if ((aux != NULL) && (aux->flags & SOCK_AUX_GET_TIMESTAMP)) {
-        _aux.timestamp = &aux->timestamp;
+        _aux->timestamp = &aux->timestamp;
     }
 #endif
 #if IS_USED(MODULE_SOCK_AUX_RSSI)
     if ((aux != NULL) && (aux->flags & SOCK_AUX_GET_RSSI)) {
-        _aux.rssi = &aux->rssi;
+        _aux->rssi = &aux->rssi;
     }
 #endif
-    res = gnrc_sock_recv((gnrc_sock_reg_t *)sock, &pkt, timeout, &tmp, &_aux);
-    if (res < 0) {
-        return res;
-    }
+}
+
+/* checks a packet from gnrc_sock_recv() against @p sock and fills @p remote
+ * and @p aux, releases @p pkt on error */
+static int _udp_accept(const sock_udp_t *sock, gnrc_pktsnip_t *pkt,
+                       const sock_ip_ep_t *tmp, sock_udp_ep_t *remote,
+                       sock_udp_aux_rx_t *aux, const gnrc_sock_recv_aux_t *_aux)
+{
+    (void)aux;
+    (void)_aux;
+    gnrc_pktsnip_t *udp;
+    udp_hdr_t *hdr;
+
     udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
     assert(udp);
     hdr = udp->data;
     if (remote != NULL) {
         /* return remote to possibly block if wrong remote */
-        memcpy(remote, &tmp, sizeof(tmp));
+        memcpy(remote, tmp, sizeof(*tmp));
         remote->port = byteorder_ntohs(hdr->src_port);
     }
-    if (!_accept_remote(sock, hdr, &tmp)) {
+    if (!_accept_remote(sock, hdr, tmp)) {
         gnrc_pktbuf_release(pkt);
         return -EPROTO;
     }
@@ -299,12 +291,12 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     }
 #endif
 #if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
-    if ((aux != NULL) && (_aux.flags & GNRC_SOCK_RECV_AUX_FLAG_TIMESTAMP)) {
+    if ((aux != NULL) && (_aux->flags & GNRC_SOCK_RECV_AUX_FLAG_TIMESTAMP)) {
         aux->flags &= ~SOCK_AUX_GET_TIMESTAMP;
     }
 #endif
 #if IS_USED(MODULE_SOCK_AUX_RSSI)
-    if ((aux != NULL) && (_aux.flags & GNRC_SOCK_RECV_AUX_FLAG_RSSI)) {
+    if ((aux != NULL) && (_aux->flags & GNRC_SOCK_RECV_AUX_FLAG_RSSI)) {
         aux->flags &= ~SOCK_AUX_GET_RSSI;
     }
 #endif
@@ -318,23 +310,117 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
         }
     }
 #endif
+    return 0;
+}
+
+ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
+                              uint32_t timeout, sock_udp_ep_t *remote,
+                              sock_udp_aux_rx_t *aux)
+{
+    (void)aux;
+    gnrc_pktsnip_t *pkt;
+    sock_ip_ep_t tmp;
+    int res;
+    gnrc_sock_recv_aux_t _aux = { 0 };
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (*buf_ctx != NULL) {
+        *data = NULL;
+        gnrc_pktbuf_release(*buf_ctx);
+        *buf_ctx = NULL;
+        return 0;
+    }
+    if (sock->local.family == AF_UNSPEC) {
+        return -EADDRNOTAVAIL;
+    }
+    tmp.family = sock->local.family;
+    _aux_setup(&_aux, aux);
+    res = gnrc_sock_recv((gnrc_sock_reg_t *)sock, &pkt, timeout, &tmp, &_aux);
+    if (res < 0) {
+        return res;
+    }
+    res = _udp_accept(sock, pkt, &tmp, remote, aux, &_aux);
+    if (res < 0) {
+        return res;
+    }
     *data = pkt->data;
     *buf_ctx = pkt;
     res = (int)pkt->size;
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_batch_rx_t *msgs,
+                        unsigned num, uint32_t timeout)
+{
+    gnrc_sock_reg_t *reg = (gnrc_sock_reg_t *)sock;
+    unsigned i = 0;
+    bool first = true;
+    int res = 0, err = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    if (sock->local.family == AF_UNSPEC) {
+        return -EADDRNOTAVAIL;
+    }
+    while (i < num) {
+        sock_udp_batch_rx_t *msg = &msgs[i];
+        gnrc_pktsnip_t *pkt;
+        sock_ip_ep_t tmp = { .family = sock->local.family };
+        gnrc_sock_recv_aux_t _aux = { 0 };
+
+        _aux_setup(&_aux, &msg->aux);
+        /* only wait for the first datagram, take the others straight from
+         * the mbox */
+        if (first) {
+            res = gnrc_sock_recv_wait(reg, &pkt, timeout, &tmp, &_aux);
+            first = false;
+        }
+        else {
+            res = gnrc_sock_recv_queued(reg, &pkt, &tmp, &_aux);
+        }
+        if (res == 0) {
+            res = _udp_accept(sock, pkt, &tmp, &msg->remote, &msg->aux, &_aux);
+        }
+        if (res == -EPROTO) {
+            /* dropped a datagram from a foreign remote, keep draining */
+            err = res;
+            continue;
+        }
+        if (res < 0) {
+            break;
+        }
+        msg->len = (pkt->size > msg->max_len) ? msg->max_len : pkt->size;
+        msg->truncated = (msg->len < pkt->size);
+        memcpy(msg->data, pkt->data, msg->len);
+        gnrc_pktbuf_release(pkt);
+        i++;
+    }
+    gnrc_sock_recv_notify(reg);
+    if (i > 0) {
+        return i;
+    }
+    /* report a dropped datagram rather than the empty mbox behind it */
+    return ((res == -EAGAIN) && (err < 0)) ? err : res;
+}
+
+/**
+ * @brief   Builds a UDP packet for sock_udp_sendv_aux() and
+ *          sock_udp_send_batch(), binds @p sock implicitly if required
+ *
+ * @param[out] pkt      The UDP header followed by the payload
+ * @param[out] local    The local end point to send from
+ * @param[out] rem      The remote end point to send to
+ *
+ * @return  0 on success
+ * @return  a negative errno of sock_udp_sendv_aux() on error
+ */
+static int _udp_build(sock_udp_t *sock, const iolist_t *snips,
+                      const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                      gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                      sock_udp_ep_t *rem)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
+    gnrc_pktsnip_t *payload = NULL;
     uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -363,7 +449,7 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
+        memset(local, 0, sizeof(*local));
         if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
@@ -389,34 +475,34 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     }
     else {
         src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
         src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
+        memcpy(rem, &sock->remote, sizeof(*rem));
         dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
         dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
 
@@ -429,12 +515,28 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     /* copy payload data into payload snip */
     iolist_to_buffer(snips, payload->data, payload->size);
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
-    if (pkt == NULL) {
+    *pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    if (*pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    return 0;
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    gnrc_pktsnip_t *pkt;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+
+    res = _udp_build(sock, snips, remote, aux, &pkt, &local, &rem);
+    if (res < 0) {
+        return res;
+    }
+    res = gnrc_sock_send(pkt, &local, (sock_ip_ep_t *)&rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -447,6 +549,108 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN) && !defined(MODULE_GNRC_NETERR) && \
+    !IS_USED(MODULE_GNRC_TX_SYNC)
+/* maximum number of datagrams sock_udp_send_batch() hands down as one train */
+#define SOCK_UDP_BATCH_TRAIN_LEN    (8U)
+
+static int _send_train(gnrc_pktsnip_t **pkts, unsigned num, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *train = gnrc_netapi_train_build(pkts, num);
+
+    if (train == NULL) {
+        for (unsigned i = 0; i < num; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        return -ENOMEM;
+    }
+    if (!gnrc_netapi_dispatch_train(type, GNRC_NETREG_DEMUX_CTX_ALL, train)) {
+        /* this should not happen, but just in case */
+        for (unsigned i = 0; i < num; i++) {
+            gnrc_pktbuf_release(gnrc_netapi_train_get(train, i));
+        }
+        gnrc_pktbuf_release(train);
+        return -EBADMSG;
+    }
+    return 0;
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_batch_tx_t *msgs,
+                        unsigned num)
+{
+    gnrc_pktsnip_t *pkts[SOCK_UDP_BATCH_TRAIN_LEN];
+    gnrc_nettype_t type, train_type = GNRC_NETTYPE_UNDEF;
+    unsigned sent = 0, queued = 0;
+    int res = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (unsigned i = 0; i < num; i++) {
+        const iolist_t snip = { NULL, (void *)msgs[i].data, msgs[i].len };
+        gnrc_pktsnip_t *pkt;
+        sock_ip_ep_t local;
+        sock_udp_ep_t rem;
+
+        res = _udp_build(sock, &snip, msgs[i].remote, NULL, &pkt, &local, &rem);
+        if ((res < 0) ||
+            ((res = gnrc_sock_build(&pkt, &type, &local, (sock_ip_ep_t *)&rem,
+                                    PROTNUM_UDP)) < 0)) {
+            break;
+        }
+        if ((queued == ARRAY_SIZE(pkts)) ||
+            ((queued > 0) && (type != train_type))) {
+            if ((res = _send_train(pkts, queued, train_type)) < 0) {
+                queued = 0;
+                gnrc_pktbuf_release(pkt);
+                break;
+            }
+            sent += queued;
+            queued = 0;
+        }
+        pkts[queued++] = pkt;
+        train_type = type;
+    }
+    if (queued > 0) {
+        int err = _send_train(pkts, queued, train_type);
+
+        if (err < 0) {
+            res = err;
+        }
+        else {
+            sent += queued;
+        }
+    }
+#ifdef SOCK_HAS_ASYNC
+    if ((sent > 0) && (sock->reg.async_cb.udp)) {
+        sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                               sock->reg.async_cb_arg);
+    }
+#endif  /* SOCK_HAS_ASYNC */
+    return (sent > 0) ? (int)sent : res;
+}
+#else
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_batch_tx_t *msgs,
+                        unsigned num)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    /* without trains (or with per-packet error reporting or TX sync) there is
+     * nothing to gain from handing down the datagrams together */
+    for (i = 0; i < num; i++) {
+        const iolist_t snip = { NULL, (void *)msgs[i].data, msgs[i].len };
+        ssize_t res = sock_udp_sendv_aux(sock, &snip, msgs[i].remote, NULL);
+
+        if (res < 0) {
+            if (i == 0) {
+                return res;
+            }
+            break;
+        }
+    }
+    return i;
+}
+#endif
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -19,6 +19,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdint.h>
 #include <string.h>
 #include <utlist.h>
 
@@ -136,6 +137,28 @@ static void _abort(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+/**
+ * @brief Takes the oldest connection from the accept backlog of @p queue.
+ *
+ * @param[in,out] queue   Listening TCB queue.
+ *
+ * @returns   Established TCB, now marked as accepted.
+ * @returns   NULL if no connection is waiting to be accepted.
+ */
+static gnrc_tcp_tcb_t *_pop_backlog(gnrc_tcp_tcb_queue_t *queue)
+{
+    TCP_DEBUG_ENTER;
+    mutex_lock(&queue->backlog_lock);
+    gnrc_tcp_tcb_t *tcb = queue->backlog;
+    if (tcb) {
+        LL_DELETE2(queue->backlog, tcb, backlog_next);
+        tcb->status |= STATUS_ACCEPTED;
+    }
+    mutex_unlock(&queue->backlog_lock);
+    TCP_DEBUG_LEAVE;
+    return tcb;
+}
+
 /* External GNRC TCP API */
 int gnrc_tcp_ep_init(gnrc_tcp_ep_t *ep, int family, const uint8_t *addr, size_t addr_size,
                      uint16_t port, uint16_t netif)
@@ -335,6 +358,9 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
     mutex_init(&queue->lock);
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+    queue->backlog = NULL;
+    queue->mbox = NULL;
+    mutex_init(&queue->backlog_lock);
     TCP_DEBUG_LEAVE;
 }
 
@@ -528,6 +554,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
 #endif
             tcb->local_port = local->port;
             tcb->status |= STATUS_LISTENING;
+            tcb->queue = queue;
 
             /* Open connection */
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
@@ -538,6 +565,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
             for (size_t j = 0; j <= i; ++j) {
                 tcb->status &= ~(STATUS_LISTENING);
                 _abort(tcb);
+                tcb->queue = NULL;
             }
             break;
         }
@@ -570,26 +598,18 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
     evtimer_mbox_event_t event_user_timeout;
-    gnrc_tcp_tcb_t *tmp = NULL;
-    _gnrc_tcp_fsm_state_t state = 0;
 
-    /* Search for non-accepted established connections */
-    *tcb = NULL;
+    /* Take the oldest non-accepted established connection */
     mutex_lock(&queue->lock);
-    for (size_t i = 0; i < queue->tcbs_len; ++i) {
-        tmp = &(queue->tcbs[i]);
-
-        if (tmp->status & STATUS_ACCEPTED) {
-            continue;
-        }
+    *tcb = _pop_backlog(queue);
 
-        state = _gnrc_tcp_fsm_get_state(tmp);
-        if (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT) {
-            tmp->status |= STATUS_ACCEPTED;
-            *tcb = tmp;
-            break;
+    /* Count TCBs that are not accepted, only needed if nothing was established */
+    if (*tcb == NULL) {
+        for (size_t i = 0; i < queue->tcbs_len; ++i) {
+            if (!(queue->tcbs[i].status & STATUS_ACCEPTED)) {
+                ++avail_tcbs;
+            }
         }
-        ++avail_tcbs;
     }
 
     /* Return if a connection was found, queue is not listening, accept was called as non-blocking
@@ -618,17 +638,11 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
         return ret;
     }
 
-    /* Setup TCBs for message exchange with the FSM */
-    for (size_t i = 0; i < queue->tcbs_len; ++i) {
-        tmp = &(queue->tcbs[i]);
-
-        /* Setup only not accepted TCBS */
-        if (!(tmp->status & STATUS_ACCEPTED)) {
-            mutex_lock(&(tmp->function_lock));
-            tmp->status |= STATUS_LOCKED;
-            _gnrc_tcp_fsm_set_mbox(tmp, &mbox);
-        }
-    }
+    /* Let the FSM notify this call about new connections. A connection
+     * established in the meantime is already in the backlog. */
+    mutex_lock(&queue->backlog_lock);
+    queue->mbox = &mbox;
+    mutex_unlock(&queue->backlog_lock);
 
     /* Setup User specified Timeout */
     if (user_timeout_duration_ms != GNRC_TCP_NO_TIMEOUT) {
@@ -637,18 +651,11 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
     }
 
     /* Wait until a connection was established */
-    while (ret >= 0 && *tcb == NULL) {
+    while (ret >= 0 && (*tcb = _pop_backlog(queue)) == NULL) {
         mbox_get(&mbox, &msg);
         switch (msg.type) {
             case MSG_TYPE_NOTIFY_USER:
                 TCP_DEBUG_INFO("Received MSG_TYPE_NOTIFY_USER.");
-
-                tmp = (gnrc_tcp_tcb_t *) msg.content.ptr;
-                state = _gnrc_tcp_fsm_get_state(tmp);
-                if (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT) {
-                    tmp->status |= STATUS_ACCEPTED;
-                    *tcb = tmp;
-                }
                 break;
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
@@ -664,15 +671,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
 
     /* Cleanup */
     _unsched_mbox(&event_user_timeout);
-    for (size_t i = 0; i < queue->tcbs_len; ++i) {
-        tmp = &(queue->tcbs[i]);
-
-        if (tmp->status & STATUS_LOCKED) {
-            tmp->status &= ~(STATUS_LOCKED);
-            _gnrc_tcp_fsm_set_mbox(tmp, NULL);
-            mutex_unlock(&(tmp->function_lock));
-        }
-    }
+    mutex_lock(&queue->backlog_lock);
+    queue->mbox = NULL;
+    mutex_unlock(&queue->backlog_lock);
     mutex_unlock(&queue->lock);
     TCP_DEBUG_LEAVE;
     return ret;
@@ -725,8 +726,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and the retransmit queue has room for more */
+    while (ret == 0 || tcb->pkt_retransmit_num >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -752,6 +753,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         /* Try to send data in case there nothing has been sent and we are not probing */
         if (ret == 0 && !probing_mode) {
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+
+            /* Return without waiting for an ACK if more segments may be in flight */
+            if (ret > 0 && tcb->pkt_retransmit_num < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -815,13 +821,10 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     return ret;
 }
 
-ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
-                      const uint32_t timeout_duration_ms)
+static ssize_t _recv(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event, void *data,
+                     const size_t max_len, const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
-    assert(tcb != NULL);
-    assert(data != NULL);
-
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -852,7 +855,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     /* If FIN was received (CLOSE_WAIT), no further data can be received. */
     /* Copy received data into given buffer and return number of bytes. Can be zero. */
     if (state == FSM_STATE_CLOSE_WAIT) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
         return ret;
@@ -860,7 +863,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
     /* If this call is non-blocking (timeout_duration_ms == 0): Try to read data and return */
     if (timeout_duration_ms == 0) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         if (ret == 0) {
             TCP_DEBUG_ERROR("-EAGAIN: Not data available, try later again.");
             ret = -EAGAIN;
@@ -892,7 +895,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
         }
 
         /* Try to read available data */
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
 
         /* If FIN was received (CLOSE_WAIT), no further data can be received. Leave event loop */
         if (state == FSM_STATE_CLOSE_WAIT) {
@@ -936,6 +939,50 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     return ret;
 }
 
+ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
+                      const uint32_t timeout_duration_ms)
+{
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    return _recv(tcb, FSM_EVENT_CALL_RECV, data, max_len, timeout_duration_ms);
+}
+
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, void **buf_ctx,
+                          const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+    assert(buf_ctx != NULL);
+
+    ssize_t ret = 0;
+
+    /* Release data of the previous call, this is valid in every state */
+    if (*buf_ctx != NULL) {
+        assert(*buf_ctx == tcb->rcv_pkt_borrowed);
+        mutex_lock(&(tcb->function_lock));
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV_BUF_DONE, NULL, NULL, 0);
+        mutex_unlock(&(tcb->function_lock));
+        *data = NULL;
+        *buf_ctx = NULL;
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* Only a single packet can be lent at a time. No length limit applies as
+     * the data is not copied. */
+    assert(tcb->rcv_pkt_borrowed == NULL);
+    ret = _recv(tcb, FSM_EVENT_CALL_RECV_BUF, data, SIZE_MAX, timeout_duration_ms);
+    if (ret > 0) {
+        *buf_ctx = tcb->rcv_pkt_borrowed;
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+#endif
+
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -974,6 +1021,7 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
         /* Clear LISTENING status causing re-opening on close */
         tcb->status &= ~(STATUS_LISTENING);
         _close(tcb);
+        tcb->queue = NULL;
 
         mutex_unlock(&(tcb->function_lock));
     }
@@ -981,6 +1029,9 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
     /* Cleanup */
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+    mutex_lock(&queue->backlog_lock);
+    queue->backlog = NULL;
+    mutex_unlock(&queue->backlog_lock);
     mutex_unlock(&(queue->lock));
     TCP_DEBUG_LEAVE;
 }
@@ -1108,6 +1159,12 @@ int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_h
         return -EBADMSG;
     }
 
+    /* Segments of synchronized connections carry their final checksum */
+    if (((tcp_hdr_t *)hdr->data)->checksum.u16 != 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
     csum = _gnrc_tcp_pkt_calc_csum(hdr, pseudo_hdr, hdr->next);
     if (csum == 0) {
         TCP_DEBUG_ERROR("-ENOENT");
@@ -17,11 +17,94 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <string.h>
+#include "assert.h"
 #include "include/gnrc_tcp_common.h"
 
-static _gnrc_tcp_common_tcb_list_t _list = {NULL, MUTEX_INIT};
+#ifdef MODULE_GNRC_IPV6
+#include "net/ipv6/addr.h"
+#endif
+
+static_assert((CONFIG_GNRC_TCP_TCB_HASH_BUCKETS > 0) &&
+              ((CONFIG_GNRC_TCP_TCB_HASH_BUCKETS & (CONFIG_GNRC_TCP_TCB_HASH_BUCKETS - 1)) == 0),
+              "CONFIG_GNRC_TCP_TCB_HASH_BUCKETS must be a power of 2");
+
+static _gnrc_tcp_common_tcb_list_t _list = { .lock = MUTEX_INIT };
+
+static gnrc_tcp_tcb_t **_bucket_of(gnrc_tcp_tcb_t *tcb)
+{
+#ifdef MODULE_GNRC_IPV6
+    return _gnrc_tcp_common_get_bucket(tcb->local_port, tcb->peer_port, tcb->peer_addr);
+#else
+    return _gnrc_tcp_common_get_bucket(tcb->local_port, tcb->peer_port, NULL);
+#endif
+}
+
+static gnrc_tcp_tcb_t **_head_of(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->peer_port == PORT_UNSPEC) {
+        return &_list.listen;
+    }
+    return _bucket_of(tcb);
+}
+
+static bool _unlink(gnrc_tcp_tcb_t **head, gnrc_tcp_tcb_t *tcb)
+{
+    for (gnrc_tcp_tcb_t **iter = head; *iter; iter = &(*iter)->next) {
+        if (*iter == tcb) {
+            *iter = tcb->next;
+            tcb->next = NULL;
+            return true;
+        }
+    }
+    return false;
+}
 
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void)
 {
     return &_list;
 }
+
+gnrc_tcp_tcb_t **_gnrc_tcp_common_get_bucket(uint16_t local_port, uint16_t peer_port,
+                                             const uint8_t *peer_addr)
+{
+    uint32_t hash = ((uint32_t)peer_port << 16) ^ local_port;
+
+#ifdef MODULE_GNRC_IPV6
+    if (peer_addr != NULL) {
+        /* the interface identifier differs most between peers */
+        uint32_t iid[2];
+
+        memcpy(iid, peer_addr + sizeof(ipv6_addr_t) - sizeof(iid), sizeof(iid));
+        hash ^= iid[0] ^ iid[1];
+    }
+#else
+    (void)peer_addr;
+#endif
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return &_list.conns[hash & (CONFIG_GNRC_TCP_TCB_HASH_BUCKETS - 1)];
+}
+
+void _gnrc_tcp_common_tcb_list_add(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_tcb_t **head = _head_of(tcb);
+
+    for (gnrc_tcp_tcb_t *iter = *head; iter; iter = iter->next) {
+        if (iter == tcb) {
+            return;
+        }
+    }
+    tcb->next = *head;
+    *head = tcb;
+}
+
+void _gnrc_tcp_common_tcb_list_del(gnrc_tcp_tcb_t *tcb)
+{
+    /* A TCB that just received a SYN already knows its peer, but is still
+     * listed as listening */
+    if (!_unlink(&_list.listen, tcb) && (tcb->peer_port != PORT_UNSPEC)) {
+        _unlink(_bucket_of(tcb), tcb);
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ * @}
+ */
+#include "clist.h"
+#include "congure/reno.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _ss_cwnd_inc(congure_reno_snd_t *c);
+static void _ca_cwnd_inc(congure_reno_snd_t *c);
+
+static const congure_reno_snd_consts_t _consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    .ss_cwnd_inc = _ss_cwnd_inc,
+    .ca_cwnd_inc = _ca_cwnd_inc,
+    .init_mss = CONFIG_GNRC_TCP_MSS,
+    /* see https://tools.ietf.org/html/rfc5681#section-3.1 */
+    .cwnd_upper = 2190U,
+    .cwnd_lower = 1095U,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .frthresh = CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD,
+};
+
+static void _cwnd_inc(congure_reno_snd_t *c, uint32_t inc)
+{
+    uint32_t cwnd = c->super.cwnd + inc;
+
+    c->super.cwnd = (cwnd < CONGURE_WND_SIZE_MAX) ? cwnd : CONGURE_WND_SIZE_MAX;
+}
+
+static congure_wnd_size_t _in_flight(congure_reno_snd_t *c, uint32_t len)
+{
+    /* the flight size is only an estimate after losses, never go below zero */
+    return (len < c->in_flight_size) ? len : c->in_flight_size;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* the FSM retransmits the oldest segment itself, so do nothing */
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    return ((gnrc_tcp_tcb_t *)c->super.ctx)->snd_wnd == ack->wnd;
+}
+
+static void _ss_cwnd_inc(congure_reno_snd_t *c)
+{
+    _cwnd_inc(c, c->mss);
+}
+
+static void _ca_cwnd_inc(congure_reno_snd_t *c)
+{
+    /* about one MSS per round trip, see
+     * https://tools.ietf.org/html/rfc5681#section-3.1 equation 3 */
+    uint32_t inc = ((uint32_t)c->mss * c->mss) / c->super.cwnd;
+
+    _cwnd_inc(c, (inc > 0) ? inc : 1);
+}
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    congure_reno_snd_t *c = &tcb->congure;
+
+    congure_reno_snd_setup(c, &_consts);
+    c->super.driver->init(&c->super, tcb);
+    if ((tcb->mss > 0) && (tcb->mss < CONFIG_GNRC_TCP_MSS)) {
+        congure_reno_set_mss(c, tcb->mss);
+    }
+    c->in_flight_size = 0;
+    c->last_ack = tcb->snd_una;
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    /* congestion control starts when the connection is established */
+    if (tcb->congure.super.driver == NULL) {
+        return tcb->snd_wnd;
+    }
+    return (tcb->snd_wnd < tcb->congure.super.cwnd) ? tcb->snd_wnd : tcb->congure.super.cwnd;
+}
+
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    congure_reno_snd_t *c = &tcb->congure;
+
+    if (c->super.driver != NULL) {
+        c->super.driver->report_msg_sent(&c->super, len);
+    }
+}
+
+void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    congure_reno_snd_t *c = &tcb->congure;
+    congure_snd_msg_t msg = { 0 };
+    congure_snd_ack_t ack = { 0 };
+
+    if (c->super.driver == NULL) {
+        return;
+    }
+    msg.size = _in_flight(c, len);
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Partial ACK: deflate by the amount acknowledged and add back one
+         * MSS, see https://tools.ietf.org/html/rfc6582#section-3.2 step 5 */
+        c->super.driver->report_msg_discarded(&c->super, msg.size);
+        c->super.cwnd = (c->super.cwnd > len) ? (c->super.cwnd - len) : 0;
+        _cwnd_inc(c, c->mss);
+        return;
+    }
+    ack.id = tcb->snd_una;
+    ack.wnd = tcb->snd_wnd;
+    ack.clean = 1;
+    c->super.driver->report_msg_acked(&c->super, &msg, &ack);
+}
+
+void _gnrc_tcp_congure_report_recovered(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    congure_reno_snd_t *c = &tcb->congure;
+
+    if (c->super.driver == NULL) {
+        return;
+    }
+    _gnrc_tcp_congure_report_acked(tcb, len);
+    /* Full ACK: deflate the window, see
+     * https://tools.ietf.org/html/rfc6582#section-3.2 step 3 */
+    c->super.cwnd = c->ssthresh;
+}
+
+void _gnrc_tcp_congure_report_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    congure_reno_snd_t *c = &tcb->congure;
+
+    if (c->super.driver != NULL) {
+        /* each duplicate ACK signals a segment that left the network */
+        _cwnd_inc(c, c->mss);
+    }
+}
+
+void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    congure_reno_snd_t *c = &tcb->congure;
+    congure_snd_msg_t msg = { 0 };
+    clist_node_t msgs = { NULL };
+
+    if (c->super.driver == NULL) {
+        return;
+    }
+    msg.size = _in_flight(c, len);
+    clist_rpush(&msgs, &msg.super);
+    c->super.driver->report_msgs_lost(&c->super, (congure_snd_msg_t *)&msgs);
+}
+
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    congure_reno_snd_t *c = &tcb->congure;
+    congure_snd_msg_t msg = { 0 };
+    clist_node_t msgs = { NULL };
+
+    if (c->super.driver == NULL) {
+        return;
+    }
+    msg.size = _in_flight(c, len);
+    msg.resends = tcb->retries;
+    clist_rpush(&msgs, &msg.super);
+    c->super.driver->report_msgs_timeout(&c->super, (congure_snd_msg_t *)&msgs);
+}
@@ -18,6 +18,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <utlist.h>
 #include <errno.h>
 #include "net/af.h"
@@ -46,6 +47,12 @@ static char _stack[TCP_EVENTLOOP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 
 /**
  * @brief Central evtimer for gnrc_tcp event loop
+ *
+ * The retransmission and timeout events of all connections are kept here.
+ * evtimer keeps its events in a list sorted by expiry, so scheduling and
+ * unscheduling an event walks that list: O(n) in the number of pending events,
+ * up to two per connection. A timer wheel would make this O(1), but needs a
+ * periodic tick that wakes the node even while all connections are idle.
  */
 static evtimer_t _tcp_msg_timer;
 
@@ -101,6 +108,48 @@ static int _send(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN)
+/**
+ * @brief Send function for packet trains, pass all packets down the network
+ *        stack with a single message.
+ *
+ * @param[in] train   Train of packets to send.
+ */
+static void _send_train(gnrc_pktsnip_t *train)
+{
+    TCP_DEBUG_ENTER;
+    unsigned num = gnrc_netapi_train_len(train);
+    bool valid = true;
+
+    /* NOTE: Trains are only built from segments of a single connection */
+    for (unsigned i = 0; i < num && valid; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_netapi_train_get(train, i);
+
+        valid = (gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP) != NULL) &&
+                (gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6) != NULL);
+    }
+
+    if (valid) {
+        if (!gnrc_netapi_dispatch_train(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL,
+                                        train)) {
+            for (unsigned i = 0; i < num; i++) {
+                gnrc_pktbuf_release(gnrc_netapi_train_get(train, i));
+            }
+            gnrc_pktbuf_release(train);
+            TCP_DEBUG_ERROR("Can't dispatch to network layer.");
+        }
+    }
+    /* Let _send() sort out packets with missing headers */
+    else {
+        for (unsigned i = 0; i < num; i++) {
+            _send(gnrc_netapi_train_get(train, i));
+        }
+        gnrc_pktbuf_release(train);
+    }
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 /**
  * @brief Receive function, receive packet from network layer.
  *
@@ -210,7 +259,15 @@ static int _receive(gnrc_pktsnip_t *pkt)
     /* Find TCB to for this packet */
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
     mutex_lock(&list->lock);
-    tcb = list->head;
+    /* A SYN is for a listening TCB, everything else for the connection in the
+     * bucket of ports and peer address */
+#ifdef MODULE_GNRC_IPV6
+    tcb = (syn) ? list->listen
+                : *_gnrc_tcp_common_get_bucket(dst, src,
+                                               (uint8_t *)&((ipv6_hdr_t *)ip->data)->src);
+#else
+    tcb = (syn) ? list->listen : *_gnrc_tcp_common_get_bucket(dst, src, NULL);
+#endif
     while (tcb) {
 #ifdef MODULE_GNRC_IPV6
         /* Check if current TCB is fitting for the incoming packet */
@@ -291,7 +348,7 @@ static void *_eventloop(__attribute__((unused)) void *arg)
 
     /* Register GNRC TCPs handling thread in netreg */
     gnrc_netreg_entry_t entry;
-    gnrc_netreg_entry_init_pid(&entry, GNRC_NETREG_DEMUX_CTX_ALL, _tcp_eventloop_pid);
+    gnrc_netreg_entry_init_train(&entry, GNRC_NETREG_DEMUX_CTX_ALL, _tcp_eventloop_pid);
     gnrc_netreg_register(GNRC_NETTYPE_TCP, &entry);
 
     /* dispatch NETAPI messages */
@@ -310,6 +367,14 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                 _send((gnrc_pktsnip_t *)msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN)
+            /* Pass a train of packets down the network stack */
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_SND_TRAIN.");
+                _send_train((gnrc_pktsnip_t *)msg.content.ptr);
+                break;
+#endif
+
             /* Reply to option set and set messages*/
             case GNRC_NETAPI_MSG_TYPE_SET:
             case GNRC_NETAPI_MSG_TYPE_GET:
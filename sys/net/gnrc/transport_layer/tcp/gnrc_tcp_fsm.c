@@ -25,6 +25,7 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -38,11 +39,6 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-/**
- * @brief Helper macro for LL_SEARCH to compare TCBs
- */
-#define TCB_EQUAL(a, b)      ((a) != (b))
-
 /**
  * @brief Checks if a given port number is currently used by a TCB as local_port.
  *
@@ -58,7 +54,10 @@ static int _is_local_port_in_use(const uint16_t port_number)
     TCP_DEBUG_ENTER;
     gnrc_tcp_tcb_t *iter = NULL;
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
-    LL_SEARCH_SCALAR(list->head, iter, local_port, port_number);
+    LL_SEARCH_SCALAR(list->listen, iter, local_port, port_number);
+    for (unsigned i = 0; (iter == NULL) && (i < CONFIG_GNRC_TCP_TCB_HASH_BUCKETS); i++) {
+        LL_SEARCH_SCALAR(list->conns[i], iter, local_port, port_number);
+    }
     TCP_DEBUG_LEAVE;
     return (iter != NULL);
 }
@@ -92,15 +91,94 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit_num > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (unsigned i = 0; i < tcb->pkt_retransmit_num; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
+        tcb->pkt_retransmit_num = 0;
     }
+    tcb->status &= ~(STATUS_RTT_MEASURE | STATUS_FAST_RECOVERY);
+    tcb->dup_acks = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Retransmits the oldest unacknowledged segment without waiting for
+ *        the retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ */
+static void _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->pkt_retransmit_num > 0) {
+        /* Every send attempt consumes a user, the retransmission timer keeps running */
+        gnrc_pktbuf_hold(tcb->pkt_retransmit[0], 1);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Processes an ACK for previously sent data.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg_ack   Acknowledgment number of the incoming segment.
+ */
+static void _process_new_ack(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t acked = seg_ack - tcb->snd_una;
+
+    tcb->snd_una = seg_ack;
+    tcb->dup_acks = 0;
+    _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+
+    if (!(tcb->status & STATUS_FAST_RECOVERY)) {
+        _gnrc_tcp_congure_report_acked(tcb, acked);
+    }
+    /* Partial ACK: the next segment was lost as well, retransmit it right away */
+    else if (LSS_32_BIT(seg_ack, tcb->recover)) {
+        _gnrc_tcp_congure_report_acked(tcb, acked);
+        _fast_retransmit(tcb);
+    }
+    /* Full ACK: all data sent before the loss was detected arrived */
+    else {
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+        _gnrc_tcp_congure_report_recovered(tcb, acked);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Processes a duplicate ACK, performs fast retransmit and fast recovery
+ *        as specified in RFC 5681 with the NewReno modification of RFC 6582.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _process_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks++;
+    }
+
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        _gnrc_tcp_congure_report_dup_ack(tcb);
+    }
+    /* Only enter fast recovery once per window of data */
+    else if (tcb->dup_acks == CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD &&
+             LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+        tcb->status |= STATUS_FAST_RECOVERY;
+        tcb->recover = tcb->snd_nxt;
+        _gnrc_tcp_congure_report_lost(tcb, _gnrc_tcp_pkt_get_pay_len(tcb->pkt_retransmit[0]));
+        _fast_retransmit(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -130,6 +208,48 @@ static int _restart_timewait_timer(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Appends a newly established connection to the accept backlog of its
+ *        listening queue and wakes up a blocked gnrc_tcp_accept() call.
+ *
+ * @param[in] tcb   Listening TCB that just completed the handshake.
+ */
+static void _backlog_push(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_tcb_queue_t *queue = tcb->queue;
+
+    mutex_lock(&queue->backlog_lock);
+    tcb->backlog_next = NULL;
+    LL_APPEND2(queue->backlog, tcb, backlog_next);
+    if (queue->mbox) {
+        msg_t msg;
+        msg.type = MSG_TYPE_NOTIFY_USER;
+        msg.content.ptr = tcb;
+        mbox_try_put(queue->mbox, &msg);
+    }
+    mutex_unlock(&queue->backlog_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Removes a connection from the accept backlog of its listening queue.
+ *
+ * @param[in] tcb   Listening TCB, not necessarily part of the backlog.
+ */
+static void _backlog_remove(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_tcb_queue_t *queue = tcb->queue;
+
+    mutex_lock(&queue->backlog_lock);
+    if (queue->backlog) {
+        LL_DELETE2(queue->backlog, tcb, backlog_next);
+    }
+    mutex_unlock(&queue->backlog_lock);
+    TCP_DEBUG_LEAVE;
+}
+
 /**
  * @brief Transition from current FSM state into another state.
  *
@@ -143,7 +263,6 @@ static int _restart_timewait_timer(gnrc_tcp_tcb_t *tcb)
 static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 {
     TCP_DEBUG_ENTER;
-    gnrc_tcp_tcb_t *iter = NULL;
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
 
     switch (state) {
@@ -151,12 +270,18 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear retransmit queue */
             _clear_retransmit(tcb);
 
+            /* A reopened connection starts without RTT estimation and backoff */
+            tcb->rtt_var = RTO_UNINITIALIZED;
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rto = RTO_UNINITIALIZED;
+            tcb->status &= ~STATUS_HDR_TMPL;
+
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
             {
                 /* Remove connection from active connections */
                 mutex_lock(&list->lock);
-                LL_DELETE(list->head, tcb);
+                _gnrc_tcp_common_tcb_list_del(tcb);
                 mutex_unlock(&list->lock);
 
                 /* Free potentially allocated receive buffer */
@@ -166,6 +291,14 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Re-open connection as listenng */
             else
             {
+                /* A connection that was never accepted must not be handed out anymore */
+                if (tcb->queue) {
+                    _backlog_remove(tcb);
+                }
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+                /* Drop received data the application did not read */
+                _gnrc_tcp_rcvbuf_release_buffer(tcb);
+#endif
                 TCP_DEBUG_INFO("Connection reopend");
                 state = FSM_STATE_LISTEN;
                 _transition_to(tcb, state);
@@ -177,6 +310,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear Accepted Status */
             tcb->status &= ~(STATUS_ACCEPTED);
 
+            /* Leave the bucket of the previous connection before clearing the peer */
+            mutex_lock(&list->lock);
+            _gnrc_tcp_common_tcb_list_del(tcb);
+            mutex_unlock(&list->lock);
+
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
             if (tcb->address_family == AF_INET6) {
@@ -188,21 +326,17 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 #endif
             tcb->peer_port = PORT_UNSPEC;
 
-            /* Add connection to active connections (if not already active) */
+            /* Add connection to listening connections (if not already active) */
             mutex_lock(&list->lock);
-            LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
-            if (iter == NULL) {
-                LL_PREPEND(list->head, tcb);
-            }
+            _gnrc_tcp_common_tcb_list_add(tcb);
             mutex_unlock(&list->lock);
             break;
 
         case FSM_STATE_SYN_SENT:
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
-            LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
             /* If connection is not already active: Check port number, append TCB */
-            if (iter == NULL) {
+            if (tcb->state == FSM_STATE_CLOSED) {
                 /* Check if port number was specified */
                 if (tcb->local_port != PORT_UNSPEC) {
                     /* Check if given port number is in use: return error */
@@ -217,12 +351,19 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 else {
                     tcb->local_port = _get_random_local_port();
                 }
-                LL_PREPEND(list->head, tcb);
+                _gnrc_tcp_common_tcb_list_add(tcb);
             }
             mutex_unlock(&list->lock);
             break;
 
         case FSM_STATE_SYN_RCVD:
+            /* The peer is known now: move TCB to the bucket of the connection */
+            if (tcb->state == FSM_STATE_LISTEN) {
+                mutex_lock(&list->lock);
+                _gnrc_tcp_common_tcb_list_del(tcb);
+                _gnrc_tcp_common_tcb_list_add(tcb);
+                mutex_unlock(&list->lock);
+            }
             /* Setup timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
@@ -232,10 +373,19 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+            /* Start congestion control */
+            tcb->recover = tcb->snd_una;
+            _gnrc_tcp_congure_init(tcb);
+            /* Addresses and ports are fixed from now on */
+            _gnrc_tcp_pkt_init_hdr_tmpl(tcb);
+            /* fall-through */
         case FSM_STATE_CLOSE_WAIT:
-            /* Stop timeout for listening TCBs */
+            /* Stop timeout for listening TCBs, queue new connections for accept */
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
+                if (tcb->state == FSM_STATE_SYN_RCVD && tcb->queue) {
+                    _backlog_push(tcb);
+                }
             }
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -317,27 +467,77 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    size_t mss = (CONFIG_GNRC_TCP_MSS < tcb->mss) ? CONFIG_GNRC_TCP_MSS : tcb->mss;
+    gnrc_pktsnip_t *out_pkts[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    uint16_t seq_cons[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    unsigned num = 0;
+    uint32_t snd_nxt = tcb->snd_nxt;
+
+    /* Build segments while the window is open and the retransmit queue has room */
+    while (sent < len && tcb->pkt_retransmit_num < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        uint32_t wnd_end = tcb->snd_una + _gnrc_tcp_congure_get_wnd(tcb);
+
+        if (!LSS_32_BIT(snd_nxt, wnd_end)) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = wnd_end - snd_nxt;
+        payload = (payload < mss) ? payload : mss;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+
+        /* Avoid sending small segments while waiting for ACKs (silly window syndrome) */
+        if (payload == 0 ||
+            (payload < mss && payload < (len - sent) && tcb->pkt_retransmit_num > 0)) {
+            break;
+        }
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                snd_nxt, tcb->rcv_nxt, (uint8_t *)buf + sent,
+                                payload) < 0) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        _gnrc_tcp_congure_report_sent(tcb, payload);
+        out_pkts[num] = out_pkt;
+        seq_cons[num++] = seq_con;
+        snd_nxt += seq_con;
+        sent += payload;
+    }
+
+    /* Hand all segments of this call to the network layer at once */
+    if (num > 0) {
+        _gnrc_tcp_pkt_send_train(tcb, out_pkts, seq_cons, num);
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
+}
+
+/**
+ * @brief Announce a larger receive window after the application read data.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _update_rcv_wnd(gnrc_tcp_tcb_t *tcb)
+{
+    size_t free = _gnrc_tcp_rcvbuf_get_free(tcb);
+
+    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size.
+     * The announced window is never shrunk, see _fsm_rcvd_pkt(). */
+    if ((free >= CONFIG_GNRC_TCP_MSS) && (free > tcb->rcv_wnd)) {
+        tcb->rcv_wnd = free;
+
+        /* Send ACK to announce window update */
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                            tcb->rcv_nxt, NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    }
 }
 
 /**
@@ -353,28 +553,57 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
+    if (_gnrc_tcp_rcvbuf_is_empty(tcb)) {
         TCP_DEBUG_LEAVE;
         return 0;
     }
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = _gnrc_tcp_rcvbuf_read(tcb, buf, len);
 
-    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    _update_rcv_wnd(tcb);
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
 
-        /* Send ACK to announce window update */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+/**
+ * @brief FSM handling function for lending received data to the user.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[out]    data   Pointer to store the start of the received data into.
+ *
+ * @returns   Number of bytes at @p data.
+ */
+static int _fsm_call_recv_buf(gnrc_tcp_tcb_t *tcb, void **data)
+{
+    TCP_DEBUG_ENTER;
+    int ret = _gnrc_tcp_rcvbuf_borrow(tcb, data);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+/**
+ * @brief FSM handling function for releasing data lent to the user.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero.
+ */
+static int _fsm_call_recv_buf_done(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    _gnrc_tcp_rcvbuf_return(tcb);
+
+    /* Window updates are only meaningful while the peer may send */
+    if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
+        tcb->state == FSM_STATE_FIN_WAIT_2) {
+        _update_rcv_wnd(tcb);
     }
     TCP_DEBUG_LEAVE;
-    return rcvd;
+    return 0;
 }
+#endif
 
 /**
  * @brief FSM handling function for starting connection teardown sequence.
@@ -514,7 +743,13 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             uint16_t dst = byteorder_ntohs(tcp_hdr->dst_port);
 
             /* Check if SYN request is handled by another connection */
-            lst = _gnrc_tcp_common_get_tcb_list()->head;
+            _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+            mutex_lock(&list->lock);
+#ifdef MODULE_GNRC_IPV6
+            lst = *_gnrc_tcp_common_get_bucket(dst, src, (uint8_t *)&((ipv6_hdr_t *)ip)->src);
+#else
+            lst = *_gnrc_tcp_common_get_bucket(dst, src, NULL);
+#endif
             while (lst) {
                 /* Compare port numbers and network layer addresses */
                 if (lst->local_port == dst && lst->peer_port == src) {
@@ -532,6 +767,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 }
                 lst = lst->next;
             }
+            mutex_unlock(&list->lock);
             /* Return if connection is already handled (port and addresses match) */
             /* cppcheck-suppress knownConditionTrueFalse
              * (reason: tmp *lst* can be true at runtime
@@ -712,8 +948,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
-                    tcb->snd_una = seg_ack;
-                    _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _process_new_ack(tcb, seg_ack);
+                }
+                /* Duplicate ACK: the peer received a segment out of order */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && tcb->pkt_retransmit_num > 0) {
+                    _process_dup_ack(tcb);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +978,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -777,13 +1017,15 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
 
                 /* Accept only data that is expected, to be received */
                 if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    /* Store contents in receive buffer */
+                    size_t added = _gnrc_tcp_rcvbuf_add(tcb, snp);
+                    size_t free = _gnrc_tcp_rcvbuf_get_free(tcb);
+                    size_t left = (added < tcb->rcv_wnd) ? tcb->rcv_wnd - added : 0;
+
+                    tcb->rcv_nxt += added;
+                    /* Shrink receive window, but never below what the peer
+                     * may already have sent into the announced window */
+                    tcb->rcv_wnd = (free > left) ? free : left;
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
@@ -813,7 +1055,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_num == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +1099,18 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_num > 0) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[0];
+
+        /* Leave fast recovery, no fast retransmit until all data sent so far is acknowledged */
+        _gnrc_tcp_congure_report_timeout(tcb, _gnrc_tcp_pkt_get_pay_len(pkt));
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+        tcb->dup_acks = 0;
+        tcb->recover = tcb->snd_nxt;
+
+        _gnrc_tcp_pkt_setup_retransmit(tcb, pkt, true);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+        _gnrc_tcp_congure_report_sent(tcb, _gnrc_tcp_pkt_get_pay_len(pkt));
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -973,6 +1224,14 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_CLEAR_RETRANSMIT :
             ret = _fsm_clear_retransmit(tcb);
             break;
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+        case FSM_EVENT_CALL_RECV_BUF :
+            ret = _fsm_call_recv_buf(tcb, buf);
+            break;
+        case FSM_EVENT_CALL_RECV_BUF_DONE :
+            ret = _fsm_call_recv_buf_done(tcb);
+            break;
+#endif
     }
     TCP_DEBUG_LEAVE;
     return ret;
@@ -16,6 +16,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <stddef.h>
 #include <string.h>
 #include <utlist.h>
 #include <errno.h>
@@ -49,6 +50,39 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Clamps the RTO to the configured bounds.
+ *
+ * @param[in,out] tcb   TCB holding the RTO.
+ */
+static void _bound_rto(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
+/**
+ * @brief Calculates the RTO from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the RTT estimation.
+ */
+static void _set_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without RTT estimation: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+    _bound_rto(tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -145,6 +179,116 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
+void _gnrc_tcp_pkt_init_hdr_tmpl(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    tcp_hdr_t *hdr = &tcb->hdr_tmpl;
+
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->src_port = byteorder_htons(tcb->local_port);
+    hdr->dst_port = byteorder_htons(tcb->peer_port);
+    hdr->off_ctl = byteorder_htons(
+        _gnrc_tcp_option_build_offset_control(TCP_HDR_OFFSET_MIN, 0));
+    tcb->status &= ~STATUS_HDR_TMPL;
+
+#ifdef MODULE_GNRC_IPV6
+    /* The checksum can only be done here, if the source address is known */
+    if (!ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
+        network_uint16_t prot = byteorder_htons(PROTNUM_TCP);
+        uint16_t sum;
+
+        /* Pseudo header without the length, and the ports */
+        sum = inet_csum(0, tcb->local_addr, sizeof(tcb->local_addr));
+        sum = inet_csum(sum, tcb->peer_addr, sizeof(tcb->peer_addr));
+        sum = inet_csum(sum, prot.u8, sizeof(prot));
+        sum = inet_csum(sum, (uint8_t *) hdr, offsetof(tcp_hdr_t, seq_num));
+        tcb->hdr_tmpl_sum = sum;
+        tcb->status |= STATUS_HDR_TMPL;
+    }
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Sets the final checksum of a segment built from the header template.
+ *
+ * @param[in]     tcb   TCB holding the header template.
+ * @param[in,out] hdr   TCP header without options.
+ * @param[in]     sum   Sum of the payload.
+ * @param[in]     len   Length of TCP header and payload.
+ */
+static void _finish_csum(const gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr,
+                         uint16_t sum, uint16_t len)
+{
+    network_uint16_t tmpl_sum = byteorder_htons(tcb->hdr_tmpl_sum);
+    network_uint16_t net_len = byteorder_htons(len);
+
+    sum = inet_csum(sum, tmpl_sum.u8, sizeof(tmpl_sum));
+    sum = inet_csum(sum, net_len.u8, sizeof(net_len));
+    /* Everything behind the ports, checksum and urgent pointer are zero */
+    sum = inet_csum(sum, (uint8_t *) &hdr->seq_num,
+                    sizeof(*hdr) - offsetof(tcp_hdr_t, seq_num));
+    /* Zero tells gnrc_tcp_calc_csum() to sum the segment, which then yields
+     * zero again */
+    hdr->checksum = byteorder_htons(~sum);
+}
+
+/**
+ * @brief Updates a checksum for changed header words (RFC 1624, eqn. 3).
+ *
+ * @param[in] sum   Complement of the old checksum.
+ * @param[in] old   Old header words.
+ * @param[in] new   New header words.
+ * @param[in] len   Length of @p old and @p new, a multiple of two.
+ *
+ * @returns   Complement of the new checksum.
+ */
+static uint16_t _update_csum(uint16_t sum, const uint8_t *old, const uint8_t *new,
+                             size_t len)
+{
+    for (size_t i = 0; i < len; i += 2) {
+        uint8_t old_inv[2] = { (uint8_t) ~old[i], (uint8_t) ~old[i + 1] };
+
+        sum = inet_csum(sum, old_inv, sizeof(old_inv));
+        sum = inet_csum(sum, &new[i], 2);
+    }
+    return sum;
+}
+
+/**
+ * @brief Refreshes acknowledgment number and window of a segment that is
+ *        retransmitted.
+ *
+ * @param[in]     tcb   TCB holding the connection information.
+ * @param[in,out] pkt   Segment to retransmit.
+ */
+static void _refresh_hdr(const gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *hdr;
+    tcp_hdr_t old;
+
+    if (snp == NULL) {
+        return;
+    }
+    hdr = (tcp_hdr_t *) snp->data;
+    if (!(byteorder_ntohs(hdr->off_ctl) & MSK_ACK)) {
+        return;
+    }
+    old = *hdr;
+    hdr->ack_num = byteorder_htonl(tcb->rcv_nxt);
+    hdr->window = byteorder_htons(tcb->rcv_wnd);
+
+    /* A zero checksum is summed by gnrc_tcp_calc_csum() */
+    if (hdr->checksum.u16 != 0) {
+        uint16_t sum = ~byteorder_ntohs(hdr->checksum);
+
+        sum = _update_csum(sum, old.ack_num.u8, hdr->ack_num.u8, sizeof(old.ack_num));
+        sum = _update_csum(sum, old.window.u8, hdr->window.u8, sizeof(old.window));
+        hdr->checksum = byteorder_htons(~sum);
+    }
+}
+
 int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                         uint16_t *seq_con, const uint16_t ctl,
                         const uint32_t seq_num, const uint32_t ack_num,
@@ -155,26 +299,39 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    /* Segments of a synchronized connection get their final checksum here */
+    bool tmpl = (tcb->status & STATUS_HDR_TMPL) && !(ctl & MSK_SYN);
+    uint16_t sum = 0;
 
-    /* Add payload, if supplied */
+    /* Add payload, if supplied. With the header template, copy and sum it in
+     * one pass */
     if (payload != NULL && payload_len > 0) {
-        pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
+        pay_snp = gnrc_pktbuf_add(pay_snp, tmpl ? NULL : payload, payload_len,
+                                  GNRC_NETTYPE_UNDEF);
         if (pay_snp == NULL) {
             *(out_pkt) = NULL;
             TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
             TCP_DEBUG_LEAVE;
             return -ENOMEM;
         }
+        if (tmpl) {
+            sum = inet_csum_copy(sum, pay_snp->data, payload, payload_len);
+        }
     }
 
     /* Fill TCP header */
-    tcp_hdr.src_port = byteorder_htons(tcb->local_port);
-    tcp_hdr.dst_port = byteorder_htons(tcb->peer_port);
-    tcp_hdr.checksum = byteorder_htons(0);
+    if (tmpl) {
+        tcp_hdr = tcb->hdr_tmpl;
+    }
+    else {
+        tcp_hdr.src_port = byteorder_htons(tcb->local_port);
+        tcp_hdr.dst_port = byteorder_htons(tcb->peer_port);
+        tcp_hdr.checksum = byteorder_htons(0);
+        tcp_hdr.urgent_ptr = byteorder_htons(0);
+    }
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
     tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
-    tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
     /* Add MSS option if SYN is sent */
@@ -221,6 +378,9 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
+        if (tmpl) {
+            _finish_csum(tcb, tcp_snp->data, sum, tcp_snp->size + payload_len);
+        }
         *(out_pkt) = tcp_snp;
     }
 
@@ -275,6 +435,36 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
+/**
+ * @brief Advances the send sequence and updates the RTT measurement for a
+ *        segment that is about to be sent.
+ *
+ * @param[in,out] tcb          TCB holding the connection information.
+ * @param[in]     seq_con      Sequence number consumption of the segment.
+ * @param[in]     retransmit   Flag so mark that the segment is a retransmission.
+ */
+static void _account_send(gnrc_tcp_tcb_t *tcb, const uint16_t seq_con,
+                          const bool retransmit)
+{
+    /* If this is no retransmission, advance sequence number and measure time */
+    if (!retransmit) {
+        tcb->snd_nxt += seq_con;
+
+        /* Time a single segment per round trip */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_MEASURE)) {
+            tcb->status |= STATUS_RTT_MEASURE;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = evtimer_now_msec();
+        }
+    }
+    else {
+        tcb->retries += 1;
+
+        /* Samples of retransmitted segments are ambiguous (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_MEASURE;
+    }
+}
+
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
                        const uint16_t seq_con, const bool retransmit)
 {
@@ -284,15 +474,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         TCP_DEBUG_LEAVE;
         return -EINVAL;
     }
-
-    /* If this is no retransmission, advance sequence number and measure time */
-    if (!retransmit) {
-        tcb->retries = 0;
-        tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
-    }
-    else {
-        tcb->retries += 1;
+    _account_send(tcb, seq_con, retransmit);
+    if (retransmit) {
+        _refresh_hdr(tcb, out_pkt);
     }
 
     /* Pass packet down the network stack */
@@ -305,6 +489,43 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
     return 0;
 }
 
+int _gnrc_tcp_pkt_send_train(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *const *out_pkts,
+                             const uint16_t *seq_cons, const unsigned num)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < num; i++) {
+        _account_send(tcb, seq_cons[i], false);
+    }
+
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN)
+    /* Pass all packets down the network stack with a single message */
+    gnrc_pktsnip_t *train = (num > 1) ? gnrc_netapi_train_build(out_pkts, num) : NULL;
+    if (train != NULL) {
+        if (!gnrc_netapi_dispatch_train(GNRC_NETTYPE_TCP, GNRC_NETREG_DEMUX_CTX_ALL,
+                                        train)) {
+            for (unsigned i = 0; i < num; i++) {
+                gnrc_pktbuf_release(out_pkts[i]);
+            }
+            gnrc_pktbuf_release(train);
+            TCP_DEBUG_ERROR("Can't dispatch to network layer.");
+        }
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+#endif
+
+    /* Pass packets down the network stack one by one */
+    for (unsigned i = 0; i < num; i++) {
+        if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_TCP, GNRC_NETREG_DEMUX_CTX_ALL,
+                                       out_pkts[i])) {
+            gnrc_pktbuf_release(out_pkts[i]);
+            TCP_DEBUG_ERROR("Can't dispatch to network layer.");
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 int _gnrc_tcp_pkt_chk_seq_num(const gnrc_tcp_tcb_t *tcb, const uint32_t seq_num,
                               const uint32_t seg_len)
 {
@@ -391,8 +612,15 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Only the oldest packet in the retransmit queue is retransmitted */
+    if (retransmit && (tcb->pkt_retransmit_num == 0 || tcb->pkt_retransmit[0] != pkt)) {
+        TCP_DEBUG_ERROR("-EINVAL: pkt is not the oldest packet in retransmit queue.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+
+    /* Check if retransmit queue is full */
+    if (!retransmit && tcb->pkt_retransmit_num >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -415,19 +643,17 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Append pkt and increase users: every send attempt consumes a user */
+    if (!retransmit) {
+        tcb->pkt_retransmit[tcb->pkt_retransmit_num++] = pkt;
+    }
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
+    /* RTO adjustment: a backed-off RTO is kept until a new RTT sample was
+     * taken (RFC 6298, section 5.7) */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        if (tcb->rto == RTO_UNINITIALIZED) {
+            _set_rto(tcb);
         }
     }
     else {
@@ -440,19 +666,14 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
+        _bound_rto(tcb);
     }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    /* Setup retransmission timer for the oldest packet, msg to TCP thread with ptr to TCB */
+    if (retransmit || tcb->pkt_retransmit_num == 1) {
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
     }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -461,40 +682,56 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
     uint32_t seg = 0;
+    unsigned acked = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_num == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
-    }
+    /* Release all packets that are covered by the acknowledgment */
+    while (acked < tcb->pkt_retransmit_num) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[acked], GNRC_NETTYPE_TCP);
+        if (snp == NULL) {
+            TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
 
-    hdr = (tcp_hdr_t *) snp->data;
+        hdr = (tcp_hdr_t *) snp->data;
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[acked]) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(tcb->pkt_retransmit[acked]);
+        acked++;
+    }
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    /* Remove acknowledged packets from the retransmit queue */
+    tcb->pkt_retransmit_num -= acked;
+    memmove(&tcb->pkt_retransmit[0], &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_num * sizeof(tcb->pkt_retransmit[0]));
+    tcb->retries = 0;
+    tcb->status |= STATUS_NOTIFY_USER;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_MEASURE) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_MEASURE;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -507,8 +744,17 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
                 tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
                 tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
             }
+            /* Only a new sample undoes the timer backoff (Karns Algorithm) */
+            _set_rto(tcb);
         }
     }
+
+    /* Restart retransmission timer for the remaining packets (RFC 6298, section 5) */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    if (tcb->pkt_retransmit_num > 0) {
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
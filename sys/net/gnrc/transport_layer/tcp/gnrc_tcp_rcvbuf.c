@@ -15,9 +15,13 @@
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
+#include <assert.h>
 #include <errno.h>
 #include <mutex.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -25,6 +29,232 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+/**
+ * @brief Packet buffer space a queued packet keeps.
+ *
+ * A received payload snip holds on to the headers of its segment, so
+ * these are counted as well.
+ */
+static size_t _held(const gnrc_pktsnip_t *pkt)
+{
+    return gnrc_pkt_len(pkt);
+}
+
+static void _pop(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->rcv_pkts_num--;
+    memmove(&tcb->rcv_pkts[0], &tcb->rcv_pkts[1],
+            tcb->rcv_pkts_num * sizeof(tcb->rcv_pkts[0]));
+    tcb->rcv_pkts[tcb->rcv_pkts_num] = NULL;
+    tcb->rcv_pkt_offset = 0;
+}
+
+void _gnrc_tcp_rcvbuf_init(void)
+{
+    /* Received packets are kept in the packet buffer, nothing to set up */
+}
+
+int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return 0;
+}
+
+void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->rcv_pkts_num > 0) {
+        tcb->rcv_held -= _held(tcb->rcv_pkts[0]);
+        gnrc_pktbuf_release(tcb->rcv_pkts[0]);
+        _pop(tcb);
+    }
+    /* A packet lent to the application is released by gnrc_tcp_recv_buf() */
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Unread payload of a queued packet.
+ */
+static size_t _unread(const gnrc_tcp_tcb_t *tcb, unsigned idx)
+{
+    return tcb->rcv_pkts[idx]->size - ((idx == 0) ? tcb->rcv_pkt_offset : 0);
+}
+
+/**
+ * @brief Replace a queued packet by its unread payload followed by @p tail.
+ *
+ * Both are copied into a new snip, so this is only done for payload that
+ * does not get a queue slot of its own, e.g. many small segments in flight.
+ *
+ * @returns   true on success, false if out of memory.
+ */
+static bool _coalesce(gnrc_tcp_tcb_t *tcb, unsigned idx, const gnrc_pktsnip_t *tail)
+{
+    gnrc_pktsnip_t *old = tcb->rcv_pkts[idx];
+    size_t len = _unread(tcb, idx);
+    gnrc_pktsnip_t *new = gnrc_pktbuf_add(NULL, NULL, len + tail->size,
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (new == NULL) {
+        return false;
+    }
+    memcpy(new->data, (uint8_t *)old->data + (old->size - len), len);
+    memcpy((uint8_t *)new->data + len, tail->data, tail->size);
+    tcb->rcv_held = tcb->rcv_held - _held(old) + _held(new);
+    tcb->rcv_pkts[idx] = new;
+    if (idx == 0) {
+        tcb->rcv_pkt_offset = 0;
+    }
+    gnrc_pktbuf_release(old);
+    return true;
+}
+
+/**
+ * @brief Make room for @p pkt in a full receive queue.
+ *
+ * The payload is appended to the newest packet while that stays within one
+ * MSS. Otherwise the two adjacent packets with the least payload are merged
+ * to free a slot, so the copies stay small and fit a fragmented packet buffer.
+ *
+ * @param[out] appended   Set to true if @p pkt was appended to the newest packet.
+ *
+ * @returns   true if @p pkt may be queued or was appended, false if out of memory.
+ */
+static bool _make_room(gnrc_tcp_tcb_t *tcb, const gnrc_pktsnip_t *pkt, bool *appended)
+{
+    unsigned last = tcb->rcv_pkts_num - 1;
+    unsigned best = last;
+    size_t best_len = _unread(tcb, last) + pkt->size;
+
+    for (unsigned i = 0; (best_len > CONFIG_GNRC_TCP_MSS) && (i < last); i++) {
+        size_t len = _unread(tcb, i) + _unread(tcb, i + 1);
+
+        if (len < best_len) {
+            best = i;
+            best_len = len;
+        }
+    }
+    *appended = (best == last);
+    if (*appended) {
+        return _coalesce(tcb, last, pkt);
+    }
+    if (!_coalesce(tcb, best, tcb->rcv_pkts[best + 1])) {
+        return false;
+    }
+    tcb->rcv_held -= _held(tcb->rcv_pkts[best + 1]);
+    gnrc_pktbuf_release(tcb->rcv_pkts[best + 1]);
+    memmove(&tcb->rcv_pkts[best + 1], &tcb->rcv_pkts[best + 2],
+            (last - best - 1) * sizeof(tcb->rcv_pkts[0]));
+    tcb->rcv_pkts[last] = NULL;
+    tcb->rcv_pkts_num--;
+    return true;
+}
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    size_t added = 0;
+
+    /* The payload of a segment may span several snips */
+    for (; (pkt != NULL) && (pkt->type == GNRC_NETTYPE_UNDEF); pkt = pkt->next) {
+        bool appended = false;
+
+        if ((tcb->rcv_pkts_num >= CONFIG_GNRC_TCP_RCV_QUEUE_SIZE) &&
+            !_make_room(tcb, pkt, &appended)) {
+            /* The peer retransmits anything that was not accepted */
+            TCP_DEBUG_INFO("Packet buffer is full, dropping payload.");
+            break;
+        }
+        if (!appended) {
+            /* Keep the packet instead of copying its payload */
+            gnrc_pktbuf_hold(pkt, 1);
+            tcb->rcv_pkts[tcb->rcv_pkts_num++] = pkt;
+            tcb->rcv_held += _held(pkt);
+        }
+        added += pkt->size;
+    }
+    TCP_DEBUG_LEAVE;
+    return added;
+}
+
+size_t _gnrc_tcp_rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    size_t rcvd = 0;
+
+    while ((rcvd < len) && (tcb->rcv_pkts_num > 0)) {
+        gnrc_pktsnip_t *pkt = tcb->rcv_pkts[0];
+        size_t num = pkt->size - tcb->rcv_pkt_offset;
+
+        num = (num < (len - rcvd)) ? num : (len - rcvd);
+        memcpy((uint8_t *)buf + rcvd, (uint8_t *)pkt->data + tcb->rcv_pkt_offset, num);
+        rcvd += num;
+        tcb->rcv_pkt_offset += num;
+        if (tcb->rcv_pkt_offset == pkt->size) {
+            tcb->rcv_held -= _held(pkt);
+            gnrc_pktbuf_release(pkt);
+            _pop(tcb);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
+
+bool _gnrc_tcp_rcvbuf_is_empty(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->rcv_pkts_num == 0;
+}
+
+size_t _gnrc_tcp_rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb)
+{
+    size_t slots = CONFIG_GNRC_TCP_RCV_QUEUE_SIZE - tcb->rcv_pkts_num;
+    size_t free, headroom;
+
+    /* The window covers what this connection may still hold in the packet
+     * buffer, including data lent to the application */
+    if ((slots == 0) || (tcb->rcv_held >= GNRC_TCP_RCV_BUF_SIZE)) {
+        return 0;
+    }
+    free = GNRC_TCP_RCV_BUF_SIZE - tcb->rcv_held;
+    /* Every free queue slot takes one segment of at most MSS bytes */
+    if (free > slots * CONFIG_GNRC_TCP_MSS) {
+        free = slots * CONFIG_GNRC_TCP_MSS;
+    }
+    /* Do not invite more data than the packet buffer can still take */
+    headroom = gnrc_pktbuf_free_bytes();
+    return (free < headroom) ? free : headroom;
+}
+
+size_t _gnrc_tcp_rcvbuf_borrow(gnrc_tcp_tcb_t *tcb, void **data)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb->rcv_pkt_borrowed == NULL);
+    if (tcb->rcv_pkts_num == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    gnrc_pktsnip_t *pkt = tcb->rcv_pkts[0];
+    size_t len = pkt->size - tcb->rcv_pkt_offset;
+
+    *data = (uint8_t *)pkt->data + tcb->rcv_pkt_offset;
+    tcb->rcv_pkt_borrowed = pkt;
+    _pop(tcb);
+    TCP_DEBUG_LEAVE;
+    return len;
+}
+
+void _gnrc_tcp_rcvbuf_return(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->rcv_pkt_borrowed != NULL) {
+        tcb->rcv_held -= _held(tcb->rcv_pkt_borrowed);
+        gnrc_pktbuf_release(tcb->rcv_pkt_borrowed);
+        tcb->rcv_pkt_borrowed = NULL;
+    }
+    TCP_DEBUG_LEAVE;
+}
+#else
 /**
  * @brief Receive buffer entry.
  */
@@ -124,3 +354,30 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    size_t added = 0;
+
+    while (pkt && pkt->type == GNRC_NETTYPE_UNDEF) {
+        added += ringbuffer_add(&(tcb->rcv_buf), pkt->data, pkt->size);
+        pkt = pkt->next;
+    }
+    return added;
+}
+
+size_t _gnrc_tcp_rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    return ringbuffer_get(&(tcb->rcv_buf), buf, len);
+}
+
+bool _gnrc_tcp_rcvbuf_is_empty(const gnrc_tcp_tcb_t *tcb)
+{
+    return ringbuffer_empty(&(tcb->rcv_buf));
+}
+
+size_t _gnrc_tcp_rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb)
+{
+    return ringbuffer_get_free(&(tcb->rcv_buf));
+}
+#endif
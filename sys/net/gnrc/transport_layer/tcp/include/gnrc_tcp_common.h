@@ -46,7 +46,9 @@ extern "C" {
 #define STATUS_ALLOW_ANY_ADDR (1 << 1) /**< Internal: Status bitmask ALLOW_ANY_ADDR */
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
-#define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_MEASURE    (1 << 5) /**< Internal: Status bitmask RTT_MEASURE */
+#define STATUS_FAST_RECOVERY  (1 << 6) /**< Internal: Status bitmask FAST_RECOVERY */
+#define STATUS_HDR_TMPL       (1 << 7) /**< Internal: Status bitmask HDR_TMPL */
 /** @} */
 
 /**
@@ -148,10 +150,14 @@ extern "C" {
 
 /**
  * @brief TCB list type.
+ *
+ * TCBs without a peer (in LISTEN) are kept in @p listen, all other active
+ * TCBs in the bucket selected by _gnrc_tcp_common_get_bucket().
  */
 typedef struct {
-    gnrc_tcp_tcb_t *head; /**< Head of TCB list */
-    mutex_t lock;         /**< Lock of TCB list */
+    gnrc_tcp_tcb_t *listen;                                  /**< Listening TCBs */
+    gnrc_tcp_tcb_t *conns[CONFIG_GNRC_TCP_TCB_HASH_BUCKETS]; /**< Connected TCBs */
+    mutex_t lock;                                            /**< Lock of TCB list */
 } _gnrc_tcp_common_tcb_list_t;
 
 /**
@@ -161,6 +167,42 @@ typedef struct {
  */
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void);
 
+/**
+ * @brief Get the bucket of connected TCBs for a connection.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in] local_port   Local port number of the connection.
+ * @param[in] peer_port    Peer port number of the connection.
+ * @param[in] peer_addr    Network layer address of the peer, may be NULL.
+ *
+ * @returns Head of the bucket.
+ */
+gnrc_tcp_tcb_t **_gnrc_tcp_common_get_bucket(uint16_t local_port, uint16_t peer_port,
+                                             const uint8_t *peer_addr);
+
+/**
+ * @brief Add a TCB to the TCB list if it is not already part of it.
+ *
+ * TCBs with @ref PORT_UNSPEC as peer port are added to the listening TCBs.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in,out] tcb   TCB to add.
+ */
+void _gnrc_tcp_common_tcb_list_add(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Remove a TCB from the TCB list.
+ *
+ * The peer information of @p tcb must not have changed since it was added.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in,out] tcb   TCB to remove, ignored if not part of the list.
+ */
+void _gnrc_tcp_common_tcb_list_del(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
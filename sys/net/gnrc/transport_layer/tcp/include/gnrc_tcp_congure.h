@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control of GNRC TCP using @ref sys_congure_reno.
+ *
+ * All window sizes are in bytes. Without module `gnrc_tcp_congure_reno` the
+ * functions do nothing and the send window is only limited by the peer.
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdint.h>
+#include "modules.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) || defined(DOXYGEN)
+/**
+ * @brief Initializes congestion control after the connection was established.
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the send window, limited by the peers receive window and the
+ *        congestion window.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes that may be in flight.
+ */
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports a newly sent segment.
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ * @param[in]     len   Payload length of the segment.
+ */
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t len);
+
+/**
+ * @brief Reports an ACK for new data.
+ *
+ * During fast recovery this is a partial ACK (RFC 6582, section 3.2).
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ * @param[in]     len   Number of newly acknowledged bytes.
+ */
+void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint32_t len);
+
+/**
+ * @brief Reports an ACK that ends fast recovery.
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ * @param[in]     len   Number of newly acknowledged bytes.
+ */
+void _gnrc_tcp_congure_report_recovered(gnrc_tcp_tcb_t *tcb, uint32_t len);
+
+/**
+ * @brief Reports a duplicate ACK received during fast recovery.
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ */
+void _gnrc_tcp_congure_report_dup_ack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports a segment that is considered lost due to duplicate ACKs.
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ * @param[in]     len   Payload length of the lost segment.
+ */
+void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb, uint32_t len);
+
+/**
+ * @brief Reports an expired retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ * @param[in]     len   Payload length of the segment to retransmit.
+ */
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb, uint32_t len);
+#else
+static inline void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_wnd;
+}
+
+static inline void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _gnrc_tcp_congure_report_recovered(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _gnrc_tcp_congure_report_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
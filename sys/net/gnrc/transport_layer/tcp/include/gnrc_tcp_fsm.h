@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include "mbox.h"
+#include "modules.h"
 #include "net/gnrc.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -60,7 +61,11 @@ typedef enum {
     FSM_EVENT_TIMEOUT_RETRANSMIT, /* Timeout: retransmit */
     FSM_EVENT_TIMEOUT_CONNECTION, /* Timeout: connection */
     FSM_EVENT_SEND_PROBE,         /* Send zero window probe */
-    FSM_EVENT_CLEAR_RETRANSMIT    /* Clear retransmission mechanism */
+    FSM_EVENT_CLEAR_RETRANSMIT,   /* Clear retransmission mechanism */
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+    FSM_EVENT_CALL_RECV_BUF,      /* User function call: recv_buf, lend data */
+    FSM_EVENT_CALL_RECV_BUF_DONE, /* User function call: recv_buf, release data */
+#endif
 } _gnrc_tcp_fsm_event_t;
 
 /**
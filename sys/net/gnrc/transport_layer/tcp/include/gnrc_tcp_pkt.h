@@ -43,6 +43,16 @@ extern "C" {
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt);
 
+/**
+ * @brief Sets up the header template of a synchronized connection.
+ *
+ * Segments built from the template carry their final checksum, so
+ * gnrc_tcp_calc_csum() does not sum them again.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_pkt_init_hdr_tmpl(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Build and allocate a TCB packet, TCB stores pointer to new packet.
  *
@@ -77,6 +87,22 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
                        const uint16_t seq_con, const bool retransmit);
 
+/**
+ * @brief Sends consecutive new segments to peer.
+ *
+ * With module gnrc_netapi_train all packets are passed down the network
+ * stack as a single packet train.
+ *
+ * @param[in,out] tcb        TCB holding the connection information.
+ * @param[in]     out_pkts   Packets to send, in sequence number order.
+ * @param[in]     seq_cons   Sequence number consumption of each packet.
+ * @param[in]     num        Number of packets in @p out_pkts.
+ *
+ * @returns   Zero on success.
+ */
+int _gnrc_tcp_pkt_send_train(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *const *out_pkts,
+                             const uint16_t *seq_cons, const unsigned num);
+
 /**
  * @brief Verify sequence number.
  *
@@ -117,13 +143,14 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or @p retransmit is set and @p pkt is not
+ *            the oldest packet in the retransmission queue.
  */
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -12,7 +12,12 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for allocating and accessing the receive buffer.
+ *
+ * By default, received payload is copied into one of
+ * @ref CONFIG_GNRC_TCP_RCV_BUFFERS ringbuffers. With module
+ * `gnrc_tcp_recv_buf`, received packets are queued in the TCB instead and
+ * their payload stays in the packet buffer until it was read.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
@@ -20,6 +25,10 @@
 #ifndef GNRC_TCP_RCVBUF_H
 #define GNRC_TCP_RCVBUF_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include "modules.h"
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -48,6 +57,70 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Add the payload of a received segment to the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     pkt   Received packet, starting with the payload.
+ *
+ * @returns   Number of payload bytes that were accepted.
+ */
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Copy received data out of the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[out]    buf   Buffer to copy the data into.
+ * @param[in]     len   Size of @p buf.
+ *
+ * @returns   Number of bytes copied into @p buf.
+ */
+size_t _gnrc_tcp_rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
+
+/**
+ * @brief Check if the receive buffer holds no data to read.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   true if there is no data to read, false otherwise.
+ */
+bool _gnrc_tcp_rcvbuf_is_empty(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the number of bytes the receive buffer can still take.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Free space of the receive buffer in bytes.
+ */
+size_t _gnrc_tcp_rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb);
+
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF) || defined(DOXYGEN)
+/**
+ * @brief Lend the oldest received data to the application without copying.
+ *
+ * The packet holding the data is removed from the queue and stays in the
+ * packet buffer until _gnrc_tcp_rcvbuf_return() is called.
+ *
+ * @pre No other packet is currently lent to the application.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[out]    data   Start of the received data.
+ *
+ * @returns   Number of bytes at @p data.
+ *            0 if no data was received.
+ */
+size_t _gnrc_tcp_rcvbuf_borrow(gnrc_tcp_tcb_t *tcb, void **data);
+
+/**
+ * @brief Release the packet lent by _gnrc_tcp_rcvbuf_borrow().
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_return(gnrc_tcp_tcb_t *tcb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
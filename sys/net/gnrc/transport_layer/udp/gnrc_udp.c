@@ -22,6 +22,7 @@
 #include <errno.h>
 
 #include "byteorder.h"
+#include "container.h"
 #include "msg.h"
 #include "thread.h"
 #include "utlist.h"
@@ -45,6 +46,13 @@ static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+/**
+ * @brief   Maximum number of packets handed to the network layer as one train
+ */
+#define GNRC_UDP_TRAIN_LEN      (8U)
+#endif
+
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
  *
@@ -161,21 +169,24 @@ static void _receive(gnrc_pktsnip_t *pkt)
     }
 }
 
-static void _send(gnrc_pktsnip_t *pkt)
+/* prepares the UDP header of pkt, returns the packet to hand to the network
+ * layer of type *target_type or NULL on error */
+static gnrc_pktsnip_t *_prepare(gnrc_pktsnip_t *pkt,
+                                gnrc_nettype_t *target_type)
 {
     udp_hdr_t *hdr;
     gnrc_pktsnip_t *udp_snip, *tmp;
-    gnrc_nettype_t target_type = pkt->type;
 
     /* write protect first header */
     tmp = gnrc_pktbuf_start_write(pkt);
     if (tmp == NULL) {
         DEBUG("udp: cannot send packet: unable to allocate packet\n");
         gnrc_pktbuf_release(pkt);
-        return;
+        return NULL;
     }
     pkt = tmp;
     udp_snip = tmp->next;
+    *target_type = pkt->type;
 
     /* get and write protect until udp snip */
     while ((udp_snip != NULL) && (udp_snip->type != GNRC_NETTYPE_UDP)) {
@@ -183,7 +194,7 @@ static void _send(gnrc_pktsnip_t *pkt)
         if (udp_snip == NULL) {
             DEBUG("udp: cannot send packet: unable to allocate packet\n");
             gnrc_pktbuf_release(pkt);
-            return;
+            return NULL;
         }
         tmp->next = udp_snip;
         tmp = udp_snip;
@@ -197,7 +208,7 @@ static void _send(gnrc_pktsnip_t *pkt)
     if (udp_snip == NULL) {
         DEBUG("udp: cannot send packet: unable to allocate packet\n");
         gnrc_pktbuf_release(pkt);
-        return;
+        return NULL;
     }
     tmp->next = udp_snip;
     hdr = (udp_hdr_t *)udp_snip->data;
@@ -205,10 +216,19 @@ static void _send(gnrc_pktsnip_t *pkt)
     hdr->length = byteorder_htons(gnrc_pkt_len(udp_snip));
 
     /* set to IPv6, if first header is netif header */
-    if (target_type == GNRC_NETTYPE_NETIF) {
-        target_type = pkt->next->type;
+    if (*target_type == GNRC_NETTYPE_NETIF) {
+        *target_type = pkt->next->type;
     }
+    return pkt;
+}
+
+static void _send(gnrc_pktsnip_t *pkt)
+{
+    gnrc_nettype_t target_type;
 
+    if ((pkt = _prepare(pkt, &target_type)) == NULL) {
+        return;
+    }
     /* and forward packet to the network layer */
     if (!gnrc_netapi_dispatch_send(target_type, GNRC_NETREG_DEMUX_CTX_ALL,
                                    pkt)) {
@@ -217,12 +237,69 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+static void _send_pkts(gnrc_pktsnip_t **pkts, unsigned num,
+                       gnrc_nettype_t target_type)
+{
+    gnrc_pktsnip_t *train = (num > 1) ? gnrc_netapi_train_build(pkts, num)
+                                      : NULL;
+
+    if (train == NULL) {
+        /* single packet or packet buffer full: send packets one by one */
+        for (unsigned i = 0; i < num; i++) {
+            if (!gnrc_netapi_dispatch_send(target_type,
+                                           GNRC_NETREG_DEMUX_CTX_ALL,
+                                           pkts[i])) {
+                DEBUG("udp: cannot send packet: network layer not found\n");
+                gnrc_pktbuf_release(pkts[i]);
+            }
+        }
+    }
+    else if (!gnrc_netapi_dispatch_train(target_type,
+                                         GNRC_NETREG_DEMUX_CTX_ALL, train)) {
+        DEBUG("udp: cannot send train: network layer not found\n");
+        for (unsigned i = 0; i < num; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        gnrc_pktbuf_release(train);
+    }
+}
+
+static void _send_train(gnrc_pktsnip_t *train)
+{
+    gnrc_pktsnip_t *pkts[GNRC_UDP_TRAIN_LEN];
+    gnrc_nettype_t type, target_type = GNRC_NETTYPE_UNDEF;
+    unsigned num = 0;
+
+    /* preparing the headers may have to copy the packets, so the packets for
+     * the network layer are collected in a new train */
+    for (unsigned i = 0; i < gnrc_netapi_train_len(train); i++) {
+        gnrc_pktsnip_t *pkt = _prepare(gnrc_netapi_train_get(train, i), &type);
+
+        if (pkt == NULL) {
+            continue;
+        }
+        if ((num == ARRAY_SIZE(pkts)) ||
+            ((num > 0) && (type != target_type))) {
+            _send_pkts(pkts, num, target_type);
+            num = 0;
+        }
+        pkts[num++] = pkt;
+        target_type = type;
+    }
+    if (num > 0) {
+        _send_pkts(pkts, num, target_type);
+    }
+    gnrc_pktbuf_release(train);
+}
+#endif
+
 static void *_event_loop(void *arg)
 {
     (void)arg;
     msg_t msg, reply;
-    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
-                                                            thread_getpid());
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_TRAIN(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              thread_getpid());
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
@@ -243,6 +320,12 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
                 break;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND_TRAIN\n");
+                _send_train(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
             case GNRC_NETAPI_MSG_TYPE_GET:
                 msg_reply(&msg, &reply);
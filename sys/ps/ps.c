@@ -30,6 +30,10 @@
 #include "ztimer.h"
 #endif
 
+#ifdef MODULE_SCHED_CYCLES
+#include "sched_cycles.h"
+#endif
+
 #ifdef MODULE_TLSF_MALLOC
 #include "tlsf.h"
 #include "tlsf-malloc.h"
@@ -54,6 +58,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHED_CYCLES
+           "| cpu      | switches  | cpu_msec   "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -88,6 +95,24 @@ void ps(void)
     }
 #endif /* MODULE_SCHEDSTATISTICS */
 
+#ifdef MODULE_SCHED_CYCLES
+    sched_cycles_update();
+
+    uint64_t cycles_sum = 0;
+    uint32_t cycles_per_ms = sched_cycles_freq() / 1000;
+    if (!IS_ACTIVE(MODULE_CORE_IDLE_THREAD)) {
+        cycles_sum = sched_cycles_pidlist[KERNEL_PID_UNDEF].cycles;
+    }
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) != NULL) {
+            cycles_sum += sched_cycles_pidlist[i].cycles;
+        }
+    }
+    if (cycles_sum == 0) {
+        cycles_sum = 1;
+    }
+#endif /* MODULE_SCHED_CYCLES */
+
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
 
@@ -109,6 +134,13 @@ void ps(void)
             unsigned runtime_major = runtime_us / rt_sum;
             unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
+#endif
+#ifdef MODULE_SCHED_CYCLES
+            uint64_t cycles = sched_cycles_pidlist[i].cycles * 100;
+            unsigned cpu_major = cycles / cycles_sum;
+            unsigned cpu_minor = ((cycles % cycles_sum) * 1000) / cycles_sum;
+            unsigned cpu_switches = sched_cycles_pidlist[i].switches;
+            uint32_t cpu_ms = sched_cycles_pidlist[i].cycles / cycles_per_ms;
 #endif
             printf("\t%3" PRIkernel_pid
 #ifdef CONFIG_THREAD_NAMES
@@ -120,6 +152,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHED_CYCLES
+                   " | %2u.%03u%% |  %8u  | %10" PRIu32 " "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -133,6 +168,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHED_CYCLES
+                   , cpu_major, cpu_minor, cpu_switches, cpu_ms
 #endif
                   );
         }
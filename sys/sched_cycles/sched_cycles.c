@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_cycles
+ * @{
+ *
+ * @file
+ * @brief       Cycle counter based thread accounting implementation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "cpu.h"
+#include "irq.h"
+#include "periph_conf.h"
+#include "sched_cycles.h"
+#include "thread.h"
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+#define SCHED_CYCLES_DWT    1
+#else
+#include "periph/timer.h"
+#include "ztimer.h"
+#include "ztimer/config.h"
+#endif
+
+sched_cycles_t sched_cycles_pidlist[KERNEL_PID_LAST + 1];
+
+/* thread the time since _last is accounted to */
+static kernel_pid_t _active;
+static uint32_t _last;
+/* the counter must not be read before it is started */
+static bool _running;
+
+#ifdef SCHED_CYCLES_DWT
+static inline uint32_t _now(void)
+{
+    return DWT->CYCCNT;
+}
+
+static inline uint32_t _elapsed(uint32_t now)
+{
+    return now - _last;
+}
+
+static void _counter_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#ifdef CPU_CORE_CORTEX_M7
+    /* unlock the DWT registers */
+    DWT->LAR = 0xC5ACCE55;
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t sched_cycles_freq(void)
+{
+    return CLOCK_CORECLOCK;
+}
+#else
+static inline uint32_t _now(void)
+{
+    return timer_read(CONFIG_ZTIMER_USEC_DEV);
+}
+
+static inline uint32_t _elapsed(uint32_t now)
+{
+    return (now - _last) & (UINT32_MAX >> (32 - CONFIG_ZTIMER_USEC_WIDTH));
+}
+
+static void _counter_init(void)
+{
+    /* the timer is initialized by ztimer, just keep it running */
+    ztimer_acquire(ZTIMER_USEC);
+}
+
+uint32_t sched_cycles_freq(void)
+{
+    return CONFIG_ZTIMER_USEC_BASE_FREQ;
+}
+#endif
+
+static inline void _account(uint32_t now)
+{
+    sched_cycles_pidlist[_active].cycles += _elapsed(now);
+    _last = now;
+}
+
+void sched_switch_callback(kernel_pid_t next)
+{
+    if (!_running) {
+        return;
+    }
+
+    _account(_now());
+    _active = next;
+    sched_cycles_pidlist[next].switches++;
+}
+
+void thread_create_callback(kernel_pid_t pid)
+{
+    /* the PID may be reused, start from zero */
+    sched_cycles_pidlist[pid] = (sched_cycles_t){ 0 };
+}
+
+void sched_cycles_update(void)
+{
+    unsigned state = irq_disable();
+
+    if (_running) {
+        _account(_now());
+    }
+    irq_restore(state);
+}
+
+void sched_cycles_init(void)
+{
+    _counter_init();
+
+    unsigned state = irq_disable();
+
+    _active = thread_getpid();
+    sched_cycles_pidlist[_active].switches = 1;
+    _last = _now();
+    _running = true;
+    irq_restore(state);
+}
+
+unsigned sched_cycles_snapshot(sched_cycles_entry_t *entries, unsigned numof)
+{
+    unsigned num = 0;
+    unsigned state = irq_disable();
+
+    if (_running) {
+        _account(_now());
+    }
+
+    for (kernel_pid_t pid = IS_USED(MODULE_CORE_IDLE_THREAD)
+                            ? KERNEL_PID_FIRST : KERNEL_PID_UNDEF;
+         (pid <= KERNEL_PID_LAST) && (num < numof); pid++) {
+        if ((pid != KERNEL_PID_UNDEF) && (thread_get_unchecked(pid) == NULL)) {
+            continue;
+        }
+        entries[num++] = (sched_cycles_entry_t){
+            .cycles = sched_cycles_pidlist[pid].cycles,
+            .switches = sched_cycles_pidlist[pid].switches,
+            .pid = pid,
+        };
+    }
+    irq_restore(state);
+
+    return num;
+}
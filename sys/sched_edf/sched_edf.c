@@ -0,0 +1,367 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First scheduling class implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#include "irq.h"
+#include "sched_edf.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+#include "schedstatistics.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert(CONFIG_SCHED_EDF_PRIO_HIGHEST + CONFIG_SCHED_EDF_NUMOF
+              <= CONFIG_SCHED_EDF_PRIO_BACKGROUND,
+              "EDF priority band overlaps the background priority");
+static_assert(CONFIG_SCHED_EDF_PRIO_BACKGROUND < SCHED_PRIO_LEVELS,
+              "EDF background priority out of range");
+
+enum {
+    _JOB,           /**< job released, within budget */
+    _DEPLETED,      /**< job released, budget exhausted */
+    _WAITING,       /**< job finished, waiting for the next release */
+};
+
+typedef struct {
+    ztimer_t release;           /**< releases the next job                 */
+    sched_edf_stats_t stats;    /**< period, budget and counters           */
+    uint32_t deadline;          /**< absolute deadline of the current job  */
+    uint32_t consumed;          /**< CPU time used by the current job      */
+    uint32_t started;           /**< time the thread was last scheduled in */
+    kernel_pid_t pid;           /**< KERNEL_PID_UNDEF if slot is unused    */
+    uint8_t state;              /**< one of _JOB, _DEPLETED, _WAITING      */
+    uint8_t prio_orig;          /**< priority before admission             */
+    bool late;                  /**< a job was released before the previous
+                                     one finished                          */
+} _edf_thread_t;
+
+static void _budget_expired(void *arg);
+
+static _edf_thread_t _threads[CONFIG_SCHED_EDF_NUMOF];
+static ztimer_t _budget_timer = { .callback = _budget_expired };
+/* thread of this class that is currently running, if any */
+static _edf_thread_t *_current;
+/* total utilization in per mille */
+static unsigned _utilization;
+
+static _edf_thread_t *_find(kernel_pid_t pid)
+{
+    for (unsigned i = 0; i < CONFIG_SCHED_EDF_NUMOF; i++) {
+        if (_threads[i].pid == pid) {
+            return &_threads[i];
+        }
+    }
+    return NULL;
+}
+
+static unsigned _util(uint32_t period, uint32_t budget)
+{
+    /* round up, so admission control never underestimates */
+    return ((uint64_t)budget * 1000 + period - 1) / period;
+}
+
+static void _set_prio(_edf_thread_t *e, uint8_t prio)
+{
+    sched_change_priority(thread_get_unchecked(e->pid), prio);
+}
+
+/* Assigns the priorities of the band to all threads with a pending job in
+ * order of their deadlines. Must be called with interrupts disabled. */
+static void _reassign(void)
+{
+    _edf_thread_t *order[CONFIG_SCHED_EDF_NUMOF];
+    unsigned num = 0;
+
+    for (unsigned i = 0; i < CONFIG_SCHED_EDF_NUMOF; i++) {
+        _edf_thread_t *e = &_threads[i];
+
+        if (e->pid == KERNEL_PID_UNDEF) {
+            continue;
+        }
+        if (e->state == _DEPLETED) {
+            _set_prio(e, CONFIG_SCHED_EDF_PRIO_BACKGROUND);
+        }
+        if (e->state != _JOB) {
+            continue;
+        }
+
+        unsigned pos = num++;
+
+        while ((pos > 0) && ((int32_t)(e->deadline - order[pos - 1]->deadline) < 0)) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = e;
+    }
+
+    for (unsigned i = 0; i < num; i++) {
+        _set_prio(order[i], CONFIG_SCHED_EDF_PRIO_HIGHEST + i);
+    }
+}
+
+static void _arm_budget(_edf_thread_t *e)
+{
+    uint32_t left = (e->consumed < e->stats.budget)
+                  ? e->stats.budget - e->consumed : 0;
+
+    ztimer_set(ZTIMER_USEC, &_budget_timer, left);
+}
+
+/* Yields if the critical section requested a context switch. On platforms
+ * that defer the switch until interrupts are enabled, this is a no-op. */
+static void _yield_if_requested(void)
+{
+    if (!irq_is_in() && sched_context_switch_request) {
+        thread_yield_higher();
+    }
+}
+
+static void _budget_expired(void *arg)
+{
+    (void)arg;
+    _edf_thread_t *e = _current;
+
+    if ((e == NULL) || (e->state != _JOB)) {
+        return;
+    }
+
+    DEBUG("sched_edf: pid %" PRIkernel_pid " exhausted its budget\n", e->pid);
+    e->consumed = e->stats.budget;
+    e->state = _DEPLETED;
+    e->stats.overruns++;
+    _reassign();
+}
+
+static void _release(void *arg)
+{
+    _edf_thread_t *e = arg;
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    bool wakeup = (e->state == _WAITING);
+
+    e->stats.jobs++;
+    if (!wakeup) {
+        DEBUG("sched_edf: pid %" PRIkernel_pid " missed its deadline\n", e->pid);
+        e->stats.deadline_misses++;
+        e->late = true;
+    }
+
+    e->state = _JOB;
+    e->consumed = 0;
+    if (e == _current) {
+        e->started = now;
+        _arm_budget(e);
+    }
+
+    e->deadline += e->stats.period;
+    if ((int32_t)(e->deadline - now) <= 0) {
+        /* fell behind by more than a period, restart from now */
+        e->deadline = now + e->stats.period;
+    }
+    ztimer_set(ZTIMER_USEC, &e->release, e->deadline - now);
+
+    if (wakeup) {
+        thread_t *thread = thread_get_unchecked(e->pid);
+
+        if (thread->status == STATUS_SLEEPING) {
+            sched_set_status(thread, STATUS_PENDING);
+        }
+    }
+    _reassign();
+    if (wakeup) {
+        thread_yield_higher();
+    }
+}
+
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+    sched_statistics_cb(active, next);
+#endif
+
+    if ((_current != NULL) && (active == _current->pid)) {
+        ztimer_remove(ZTIMER_USEC, &_budget_timer);
+        _current->consumed += ztimer_now(ZTIMER_USEC) - _current->started;
+        _current = NULL;
+    }
+
+    if (next != KERNEL_PID_UNDEF) {
+        _edf_thread_t *e = _find(next);
+
+        if (e != NULL) {
+            _current = e;
+            e->started = ztimer_now(ZTIMER_USEC);
+            if (e->state == _JOB) {
+                _arm_budget(e);
+            }
+        }
+    }
+}
+
+void sched_edf_init(void)
+{
+    sched_register_cb(_sched_cb);
+}
+
+int sched_edf_admit(kernel_pid_t pid, uint32_t period_us, uint32_t budget_us)
+{
+    thread_t *thread = thread_get(pid);
+
+    if ((thread == NULL) || (budget_us == 0) || (budget_us > period_us)) {
+        return -EINVAL;
+    }
+
+    unsigned util = _util(period_us, budget_us);
+    unsigned state = irq_disable();
+    _edf_thread_t *e = NULL;
+    int res = 0;
+
+    if (_find(pid) != NULL) {
+        res = -EALREADY;
+    }
+    else if ((e = _find(KERNEL_PID_UNDEF)) == NULL) {
+        res = -ENOMEM;
+    }
+    else if (_utilization + util > CONFIG_SCHED_EDF_UTIL_MAX) {
+        res = -EBUSY;
+    }
+    else {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        *e = (_edf_thread_t){
+            .release = { .callback = _release, .arg = e },
+            .stats = { .period = period_us, .budget = budget_us, .jobs = 1 },
+            .deadline = now + period_us,
+            .pid = pid,
+            .state = _JOB,
+            .prio_orig = thread->priority,
+        };
+        _utilization += util;
+        ztimer_set(ZTIMER_USEC, &e->release, period_us);
+
+        if (thread == thread_get_active()) {
+            /* admitted thread is running already, the scheduler callback
+             * did not account for it */
+            _current = e;
+            e->started = now;
+            _arm_budget(e);
+        }
+        _reassign();
+    }
+
+    irq_restore(state);
+    _yield_if_requested();
+
+    return res;
+}
+
+int sched_edf_remove(kernel_pid_t pid)
+{
+    unsigned state = irq_disable();
+    _edf_thread_t *e = _find(pid);
+
+    if (e == NULL) {
+        irq_restore(state);
+        return -ENOENT;
+    }
+
+    ztimer_remove(ZTIMER_USEC, &e->release);
+    if (e == _current) {
+        ztimer_remove(ZTIMER_USEC, &_budget_timer);
+        _current = NULL;
+    }
+    _utilization -= _util(e->stats.period, e->stats.budget);
+
+    thread_t *thread = thread_get_unchecked(pid);
+
+    if ((e->state == _WAITING) && (thread->status == STATUS_SLEEPING)) {
+        sched_set_status(thread, STATUS_PENDING);
+    }
+    _set_prio(e, e->prio_orig);
+    e->pid = KERNEL_PID_UNDEF;
+    _reassign();
+
+    irq_restore(state);
+    _yield_if_requested();
+
+    return 0;
+}
+
+void sched_edf_wait_period(void)
+{
+    unsigned state = irq_disable();
+    _edf_thread_t *e = _find(thread_getpid());
+
+    assert(e != NULL);
+
+    if (e->late) {
+        /* the next job is already released, start it right away */
+        e->late = false;
+        irq_restore(state);
+        return;
+    }
+
+    e->state = _WAITING;
+    if (e == _current) {
+        ztimer_remove(ZTIMER_USEC, &_budget_timer);
+    }
+    sched_set_status(thread_get_active(), STATUS_SLEEPING);
+    _reassign();
+
+    irq_restore(state);
+    thread_yield_higher();
+}
+
+unsigned sched_edf_overruns(kernel_pid_t pid)
+{
+    sched_edf_stats_t stats;
+
+    if (sched_edf_get_stats(pid, &stats) != 0) {
+        return 0;
+    }
+    return stats.overruns;
+}
+
+int sched_edf_get_stats(kernel_pid_t pid, sched_edf_stats_t *stats)
+{
+    assert(stats != NULL);
+
+    int res = 0;
+    unsigned state = irq_disable();
+    _edf_thread_t *e = _find(pid);
+
+    if (e == NULL) {
+        res = -ENOENT;
+    }
+    else {
+        *stats = e->stats;
+    }
+
+    irq_restore(state);
+    return res;
+}
+
+unsigned sched_edf_utilization(void)
+{
+    return _utilization;
+}
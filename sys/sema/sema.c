@@ -22,6 +22,10 @@
 #include "assert.h"
 #include "sema.h"
 
+#ifdef MODULE_WAIT_ANY
+#include "wait_any.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -32,6 +36,9 @@ void sema_create(sema_t *sema, unsigned int value)
     sema->value = value;
     sema->state = SEMA_OK;
     mutex_init(&sema->mutex);
+#ifdef MODULE_WAIT_ANY
+    sema->waiter = NULL;
+#endif
     if (value == 0) {
         mutex_lock(&sema->mutex);
     }
@@ -43,6 +50,9 @@ void sema_destroy(sema_t *sema)
 
     sema->state = SEMA_DESTROY;
     mutex_unlock(&sema->mutex);
+#ifdef MODULE_WAIT_ANY
+    wait_any_notify(sema->waiter);
+#endif
 }
 
 #if IS_USED(MODULE_SEMA_DEPRECATED)
@@ -163,10 +173,16 @@ int sema_post(sema_t *sema)
     }
 
     unsigned value = sema->value++;
+#ifdef MODULE_WAIT_ANY
+    thread_t *waiter = sema->waiter;
+#endif
     irq_restore(old);
 
     if (value == 0) {
         mutex_unlock(&sema->mutex);
+#ifdef MODULE_WAIT_ANY
+        wait_any_notify(waiter);
+#endif
     }
 
     return 0;
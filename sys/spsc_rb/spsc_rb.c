@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_spsc_rb
+ * @{
+ *
+ * @file
+ * @brief       Lock-free SPSC ringbuffer implementation
+ *
+ * The consumer advances `reads` with a compare-and-swap instead of a plain
+ * store, so that a concurrent @ref spsc_rb_clear() by the producer is
+ * detected. Without a clear, the compare-and-swap always succeeds.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "irq.h"
+#include "spsc_rb.h"
+
+#if defined(__GCC_ATOMIC_INT_LOCK_FREE) && (__GCC_ATOMIC_INT_LOCK_FREE == 2)
+static inline unsigned _load(const unsigned *ptr)
+{
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void _store(unsigned *ptr, unsigned val)
+{
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+
+static inline bool _cas(unsigned *ptr, unsigned expected, unsigned desired)
+{
+    return __atomic_compare_exchange_n(ptr, &expected, desired, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+#else
+/* no lock-free int atomics (e.g. AVR): fall back to minimal critical
+ * sections */
+static inline unsigned _load(const unsigned *ptr)
+{
+    unsigned state = irq_disable();
+    unsigned res = *(const volatile unsigned *)ptr;
+
+    irq_restore(state);
+    return res;
+}
+
+static inline void _store(unsigned *ptr, unsigned val)
+{
+    unsigned state = irq_disable();
+
+    *(volatile unsigned *)ptr = val;
+    irq_restore(state);
+}
+
+static inline bool _cas(unsigned *ptr, unsigned expected, unsigned desired)
+{
+    unsigned state = irq_disable();
+    bool res = (*ptr == expected);
+
+    if (res) {
+        *ptr = desired;
+    }
+    irq_restore(state);
+    return res;
+}
+#endif
+
+static void _copy_in(spsc_rb_t *rb, unsigned pos, const uint8_t *src,
+                     size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first >= n) {
+        memcpy(&rb->buf[idx], src, n);
+    }
+    else {
+        memcpy(&rb->buf[idx], src, first);
+        memcpy(rb->buf, src + first, n - first);
+    }
+}
+
+static void _copy_out(const spsc_rb_t *rb, unsigned pos, uint8_t *dst,
+                      size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first >= n) {
+        memcpy(dst, &rb->buf[idx], n);
+    }
+    else {
+        memcpy(dst, &rb->buf[idx], first);
+        memcpy(dst + first, rb->buf, n - first);
+    }
+}
+
+/* free space as seen by the producer */
+static unsigned _free(const spsc_rb_t *rb)
+{
+    return rb->size - (rb->writes - _load(&rb->reads));
+}
+
+unsigned spsc_rb_avail(const spsc_rb_t *rb)
+{
+    unsigned reads = _load(&rb->reads);
+
+    return _load(&rb->writes) - reads;
+}
+
+unsigned spsc_rb_free(const spsc_rb_t *rb)
+{
+    return rb->size - spsc_rb_avail(rb);
+}
+
+void spsc_rb_clear(spsc_rb_t *rb)
+{
+    _store(&rb->reads, _load(&rb->writes));
+}
+
+int spsc_rb_add_one(spsc_rb_t *rb, uint8_t c)
+{
+    if (_free(rb) == 0) {
+        return -1;
+    }
+    rb->buf[rb->writes & (rb->size - 1)] = c;
+    _store(&rb->writes, rb->writes + 1);
+
+    return 0;
+}
+
+size_t spsc_rb_add(spsc_rb_t *rb, const void *src, size_t n)
+{
+    unsigned free = _free(rb);
+
+    if (n > free) {
+        n = free;
+    }
+    _copy_in(rb, rb->writes, src, n);
+    _store(&rb->writes, rb->writes + n);
+
+    return n;
+}
+
+uint8_t *spsc_rb_reserve(spsc_rb_t *rb, size_t *len)
+{
+    unsigned idx = rb->writes & (rb->size - 1);
+    unsigned free = _free(rb);
+
+    *len = (free < rb->size - idx) ? free : rb->size - idx;
+
+    return (*len) ? &rb->buf[idx] : NULL;
+}
+
+void spsc_rb_commit(spsc_rb_t *rb, size_t n)
+{
+    assert(n <= _free(rb));
+    _store(&rb->writes, rb->writes + n);
+}
+
+int spsc_rb_add_pkt(spsc_rb_t *rb, const void *data, size_t len)
+{
+    if ((len > UINT16_MAX) || (len + SPSC_RB_PKT_HDR_SIZE > rb->size)) {
+        return -EMSGSIZE;
+    }
+    if (len + SPSC_RB_PKT_HDR_SIZE > _free(rb)) {
+        return -EAGAIN;
+    }
+
+    uint16_t hdr = len;
+
+    _copy_in(rb, rb->writes, (uint8_t *)&hdr, sizeof(hdr));
+    _copy_in(rb, rb->writes + sizeof(hdr), data, len);
+    /* header and payload become visible at once */
+    _store(&rb->writes, rb->writes + sizeof(hdr) + len);
+
+    return 0;
+}
+
+int spsc_rb_get_one(spsc_rb_t *rb)
+{
+    uint8_t c;
+
+    return (spsc_rb_get(rb, &c, 1) == 1) ? c : -1;
+}
+
+size_t spsc_rb_get(spsc_rb_t *rb, void *dst, size_t n)
+{
+    while (1) {
+        unsigned reads = _load(&rb->reads);
+        unsigned avail = _load(&rb->writes) - reads;
+        size_t len = (n < avail) ? n : avail;
+
+        _copy_out(rb, reads, dst, len);
+        if (_cas(&rb->reads, reads, reads + len)) {
+            return len;
+        }
+        /* cleared by the producer, data may have been overwritten */
+    }
+}
+
+size_t spsc_rb_peek(spsc_rb_t *rb, void *dst, size_t n)
+{
+    while (1) {
+        unsigned reads = _load(&rb->reads);
+        unsigned avail = _load(&rb->writes) - reads;
+        size_t len = (n < avail) ? n : avail;
+
+        _copy_out(rb, reads, dst, len);
+        if (_load(&rb->reads) == reads) {
+            return len;
+        }
+    }
+}
+
+size_t spsc_rb_drop(spsc_rb_t *rb, size_t n)
+{
+    while (1) {
+        unsigned reads = _load(&rb->reads);
+        unsigned avail = _load(&rb->writes) - reads;
+        size_t len = (n < avail) ? n : avail;
+
+        if (_cas(&rb->reads, reads, reads + len)) {
+            return len;
+        }
+    }
+}
+
+const uint8_t *spsc_rb_peek_region(spsc_rb_t *rb, size_t *len)
+{
+    unsigned reads = _load(&rb->reads);
+    unsigned avail = _load(&rb->writes) - reads;
+    unsigned idx = reads & (rb->size - 1);
+
+    *len = (avail < rb->size - idx) ? avail : rb->size - idx;
+
+    return (*len) ? &rb->buf[idx] : NULL;
+}
+
+void spsc_rb_consume(spsc_rb_t *rb, size_t n)
+{
+    unsigned reads;
+
+    do {
+        reads = _load(&rb->reads);
+        if (n > _load(&rb->writes) - reads) {
+            /* cleared in the meantime */
+            return;
+        }
+    } while (!_cas(&rb->reads, reads, reads + n));
+}
+
+ssize_t spsc_rb_get_pkt(spsc_rb_t *rb, void *dst, size_t size)
+{
+    while (1) {
+        unsigned reads = _load(&rb->reads);
+        unsigned avail = _load(&rb->writes) - reads;
+        uint16_t len;
+
+        if (avail < sizeof(len)) {
+            return -EAGAIN;
+        }
+        _copy_out(rb, reads, (uint8_t *)&len, sizeof(len));
+        if (len > avail - sizeof(len)) {
+            /* header read after a concurrent clear, or mixed byte access */
+            if (_load(&rb->reads) == reads) {
+                return -EAGAIN;
+            }
+            continue;
+        }
+        if (len > size) {
+            if (_load(&rb->reads) == reads) {
+                return -EMSGSIZE;
+            }
+            continue;
+        }
+        _copy_out(rb, reads + sizeof(len), dst, len);
+        if (_cas(&rb->reads, reads, reads + sizeof(len) + len)) {
+            return len;
+        }
+    }
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_stack_watermark
+ * @{
+ *
+ * @file
+ * @brief       Lazy stack watermark implementation
+ *
+ * @}
+ */
+
+#ifdef CPU_NATIVE
+/* for the register indices of mcontext_t */
+#define _GNU_SOURCE
+#include <ucontext.h>
+#endif
+
+#include <stdint.h>
+
+#include "event/periodic_callback.h"
+#include "event/thread.h"
+#include "irq.h"
+#include "stack_watermark.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+typedef struct {
+    const thread_t *thread;     /* detects reuse of the PID */
+    uintptr_t *painted;         /* [stack start, painted) has been painted */
+    uintptr_t *mark;            /* lowest word known to be used */
+    uintptr_t *cursor;          /* scan continues below, NULL: next round */
+} _watermark_t;
+
+static _watermark_t _marks[KERNEL_PID_LAST + 1];
+static kernel_pid_t _next = KERNEL_PID_FIRST;
+static stack_watermark_cb_t _cb;
+static void *_cb_arg;
+static event_periodic_callback_t _event;
+
+/* stack pointer of a thread that is not running */
+static uintptr_t *_suspended_sp(const thread_t *thread)
+{
+#ifdef CPU_NATIVE
+    /* thread->sp points to the ucontext on native */
+    const ucontext_t *ctx = (const ucontext_t *)(uintptr_t)thread->sp;
+#  if defined(__x86_64__)
+    return (uintptr_t *)ctx->uc_mcontext.gregs[REG_RSP];
+#  elif defined(__i386__)
+    return (uintptr_t *)ctx->uc_mcontext.gregs[REG_ESP];
+#  else
+#    error "stack_watermark: unsupported native host architecture"
+#  endif
+#else
+    return (uintptr_t *)(uintptr_t)thread->sp;
+#endif
+}
+
+/* must be called with interrupts disabled */
+static void _sample_sp(_watermark_t *wm, const thread_t *thread)
+{
+    uintptr_t *sp = (thread == thread_get_active())
+                  ? __builtin_frame_address(0)
+                  : _suspended_sp(thread);
+
+    if (sp < wm->mark) {
+        /* align down to a word */
+        wm->mark = (uintptr_t *)((uintptr_t)sp & ~(sizeof(uintptr_t) - 1));
+    }
+}
+
+/* must be called with interrupts disabled */
+static _watermark_t *_get(kernel_pid_t pid, const thread_t *thread)
+{
+    _watermark_t *wm = &_marks[pid];
+
+    if (wm->thread != thread) {
+        uintptr_t *start = thread_get_stackstart(thread);
+
+        wm->thread = thread;
+        wm->painted = start;
+        wm->cursor = NULL;
+        wm->mark = (uintptr_t *)(uintptr_t)((char *)start
+                                            + thread_get_stacksize(thread));
+    }
+    _sample_sp(wm, thread);
+
+    return wm;
+}
+
+static uintptr_t *_paint_limit(const _watermark_t *wm, uintptr_t *start)
+{
+    uintptr_t redzone = CONFIG_STACK_WATERMARK_REDZONE / sizeof(uintptr_t);
+
+    return ((uintptr_t)(wm->mark - start) > redzone) ? wm->mark - redzone
+                                                      : start;
+}
+
+/* Processes up to *words words of the stack of pid. Returns true when the
+ * thread is done for this round. */
+static bool _process(kernel_pid_t pid, unsigned *words)
+{
+    const thread_t *thread = thread_get(pid);
+
+    if (thread == NULL) {
+        _marks[pid].thread = NULL;
+        return true;
+    }
+
+    while (*words) {
+        unsigned n = (*words < CONFIG_STACK_WATERMARK_CHUNK_WORDS)
+                   ? *words : CONFIG_STACK_WATERMARK_CHUNK_WORDS;
+        bool done = false;
+        unsigned state = irq_disable();
+
+        if (thread_get_unchecked(pid) != thread) {
+            /* exited in the meantime */
+            irq_restore(state);
+            return true;
+        }
+
+        _watermark_t *wm = _get(pid, thread);
+        uintptr_t *start = thread_get_stackstart(thread);
+        uintptr_t *limit = _paint_limit(wm, start);
+
+        if (wm->painted < limit) {
+            uintptr_t *p = wm->painted;
+
+            while ((p < limit) && n--) {
+                *p = (uintptr_t)p;
+                p++;
+            }
+            wm->painted = p;
+        }
+        else {
+            /* walk down from the watermark, the stack grows towards start */
+            uintptr_t *top = (wm->painted < wm->mark) ? wm->painted : wm->mark;
+            uintptr_t *p = wm->cursor;
+
+            if ((p == NULL) || (p > top)) {
+                p = top;
+            }
+            /* untouched words do not end the scan: a partly written local
+             * array leaves them above deeper usage */
+            while ((p > start) && n--) {
+                p--;
+                if (*p != (uintptr_t)p) {
+                    wm->mark = p;
+                }
+            }
+            wm->cursor = p;
+            if (p == start) {
+                wm->cursor = NULL;
+                done = true;
+            }
+        }
+
+        irq_restore(state);
+
+        *words = (*words > CONFIG_STACK_WATERMARK_CHUNK_WORDS)
+               ? *words - CONFIG_STACK_WATERMARK_CHUNK_WORDS : 0;
+        if (done) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void _report(void)
+{
+    stack_watermark_cb_t cb = _cb;
+
+    if (cb == NULL) {
+        return;
+    }
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid) != NULL) {
+            cb(pid, stack_watermark_headroom(pid), _cb_arg);
+        }
+    }
+}
+
+bool stack_watermark_step(unsigned words)
+{
+    while (words) {
+        if (!_process(_next, &words)) {
+            return false;
+        }
+        if (++_next > KERNEL_PID_LAST) {
+            _next = KERNEL_PID_FIRST;
+            _report();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t stack_watermark_headroom(kernel_pid_t pid)
+{
+    size_t headroom = 0;
+    unsigned state = irq_disable();
+    const thread_t *thread = thread_get(pid);
+
+    if (thread != NULL) {
+        _watermark_t *wm = _get(pid, thread);
+
+        headroom = (char *)wm->mark - (char *)thread_get_stackstart(thread);
+    }
+    irq_restore(state);
+
+    return headroom;
+}
+
+void stack_watermark_set_cb(stack_watermark_cb_t cb, void *arg)
+{
+    unsigned state = irq_disable();
+
+    _cb = cb;
+    _cb_arg = arg;
+    irq_restore(state);
+}
+
+static void _step(void *arg)
+{
+    (void)arg;
+    stack_watermark_step(CONFIG_STACK_WATERMARK_STEP_WORDS);
+}
+
+void stack_watermark_init(void)
+{
+    event_periodic_callback_create(&_event, ZTIMER_MSEC,
+                                   CONFIG_STACK_WATERMARK_INTERVAL_MS,
+                                   EVENT_PRIO_LOWEST, _step, NULL);
+}
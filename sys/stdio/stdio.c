@@ -25,7 +25,12 @@
 #include "xfa.h"
 
 static uint8_t _rx_buf_mem[STDIO_RX_BUFSIZE];
+#ifdef MODULE_STDIO_DISPATCH
+/* every stdio provider writes its input into the pipe */
+isrpipe_t stdin_isrpipe = ISRPIPE_INIT_MULTI_PRODUCER(_rx_buf_mem);
+#else
 isrpipe_t stdin_isrpipe = ISRPIPE_INIT(_rx_buf_mem);
+#endif
 
 #ifdef MODULE_STDIO_DISPATCH
 XFA_INIT_CONST(stdio_provider_t, stdio_provider_xfa);
@@ -78,13 +83,13 @@ int stdio_available(void)
     if (!IS_USED(MODULE_STDIN)) {
         return 0;
     }
-    return tsrb_avail(&stdin_isrpipe.tsrb);
+    return spsc_rb_avail(&stdin_isrpipe.rb);
 }
 #endif
 
 void stdio_clear_stdin(void)
 {
     if (IS_USED(MODULE_STDIN)) {
-        tsrb_clear(&stdin_isrpipe.tsrb);
+        spsc_rb_clear(&stdin_isrpipe.rb);
     }
 }
@@ -171,7 +171,7 @@ static const struct ble_gatt_svc_def _gatt_svr_svcs[] =
 
 static void _purge_buffer(void)
 {
-    tsrb_clear(&stdin_isrpipe.tsrb);
+    spsc_rb_clear(&stdin_isrpipe.rb);
 
 #if IS_USED(MODULE_SHELL)
     /* send Ctrl-C to the shell to reset the input */
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_thread_pool
+ * @{
+ *
+ * @file
+ * @brief       Thread pool implementation
+ *
+ * Each stack slab starts with a small header linking the worker into the
+ * list of parked workers, the worker's stack follows. The worker gets its
+ * slab as argument, so it can return it to the pool when it exits.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread_pool.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+typedef struct {
+    list_node_t node;           /* in pool->idle while parked */
+    thread_pool_t *pool;
+    thread_t *thread;
+} _slab_hdr_t;
+
+/* offset of the stack in a slab, keeps the stack 8 byte aligned */
+#define SLAB_HDR_SIZE   ((sizeof(_slab_hdr_t) + 7) & ~7)
+
+static void *_worker(void *arg)
+{
+    _slab_hdr_t *hdr = arg;
+    thread_pool_t *pool = hdr->pool;
+
+    hdr->thread = thread_get_active();
+
+    while (1) {
+        unsigned state = irq_disable();
+        int idx = cib_get(&pool->queue);
+
+        if (idx >= 0) {
+            thread_pool_job_t job = pool->jobs[idx];
+
+            irq_restore(state);
+            job.fn(job.arg);
+            continue;
+        }
+
+        if (pool->idle_numof >= pool->keep_idle) {
+            break;
+        }
+
+        /* park until thread_pool_submit() hands over a job */
+        list_add(&pool->idle, &hdr->node);
+        pool->idle_numof++;
+        sched_set_status(hdr->thread, STATUS_SLEEPING);
+        irq_restore(state);
+        thread_yield_higher();
+    }
+
+    DEBUG("thread_pool: worker %" PRIkernel_pid " exits\n", thread_getpid());
+
+    /* Interrupts stay disabled until the thread has exited, nobody must get
+     * the slab while we still run on it. */
+    pool->workers--;
+    memarray_free(&pool->stacks, hdr);
+
+    return NULL;
+}
+
+/* must be called with interrupts disabled, does not yield */
+static int _spawn(thread_pool_t *pool, _slab_hdr_t *hdr)
+{
+    hdr->pool = pool;
+
+    kernel_pid_t pid = thread_create((char *)hdr + SLAB_HDR_SIZE,
+                                     pool->stacksize - SLAB_HDR_SIZE,
+                                     pool->priority,
+                                     THREAD_CREATE_WOUT_YIELD
+                                     | THREAD_CREATE_NO_STACKTEST,
+                                     _worker, hdr, pool->name);
+
+    if (pid < 0) {
+        memarray_free(&pool->stacks, hdr);
+        return pid;
+    }
+
+    DEBUG("thread_pool: spawned worker %" PRIkernel_pid "\n", pid);
+    pool->workers++;
+    return 0;
+}
+
+void thread_pool_init(thread_pool_t *pool, void *stacks, size_t stacksize,
+                      size_t num_stacks, thread_pool_job_t *jobs,
+                      unsigned queue_size, uint8_t priority,
+                      unsigned keep_idle, const char *name)
+{
+    assert(pool && stacks && jobs && num_stacks);
+    assert(!(stacksize & 7) && (stacksize <= UINT16_MAX));
+    assert(stacksize > SLAB_HDR_SIZE + sizeof(thread_t));
+    assert(queue_size && !(queue_size & (queue_size - 1)));
+    assert(keep_idle <= UINT8_MAX);
+
+    *pool = (thread_pool_t){
+        .jobs = jobs,
+        .name = name,
+        .stacksize = stacksize,
+        .priority = priority,
+        .keep_idle = keep_idle,
+    };
+    memarray_init(&pool->stacks, stacks, stacksize, num_stacks);
+    cib_init(&pool->queue, queue_size);
+}
+
+int thread_pool_submit(thread_pool_t *pool, thread_pool_fn_t fn, void *arg)
+{
+    assert(!irq_is_in());
+    assert(fn);
+
+    unsigned state = irq_disable();
+
+    if (cib_full(&pool->queue)) {
+        irq_restore(state);
+        return -EAGAIN;
+    }
+
+    list_node_t *node = list_remove_head(&pool->idle);
+
+    if (node != NULL) {
+        _slab_hdr_t *hdr = container_of(node, _slab_hdr_t, node);
+
+        pool->idle_numof--;
+        sched_set_status(hdr->thread, STATUS_PENDING);
+    }
+    else {
+        /* if no slab is free, all workers are busy and one of them will
+         * take the job once it is done */
+        _slab_hdr_t *hdr = memarray_alloc(&pool->stacks);
+
+        if (hdr != NULL) {
+            int res = _spawn(pool, hdr);
+
+            if ((res < 0) && (pool->workers == 0)) {
+                /* nobody would ever run the job */
+                irq_restore(state);
+                return res;
+            }
+        }
+    }
+
+    pool->jobs[cib_put(&pool->queue)] =
+        (thread_pool_job_t){ .fn = fn, .arg = arg };
+    irq_restore(state);
+    sched_switch(pool->priority);
+
+    return 0;
+}
+
+unsigned thread_pool_pending(thread_pool_t *pool)
+{
+    unsigned state = irq_disable();
+    unsigned pending = cib_avail(&pool->queue);
+
+    irq_restore(state);
+    return pending;
+}
+
+unsigned thread_pool_workers(thread_pool_t *pool)
+{
+    return pool->workers;
+}
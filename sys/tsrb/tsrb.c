@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -35,6 +37,36 @@ static uint8_t _peek(tsrb_t *rb, unsigned int idx)
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
 
+/* the bulk copies below are done in at most two contiguous parts */
+static void _copy_out(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned idx = rb->reads & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first >= n) {
+        memcpy(dst, &rb->buf[idx], n);
+    }
+    else {
+        memcpy(dst, &rb->buf[idx], first);
+        memcpy(dst + first, rb->buf, n - first);
+    }
+}
+
+static void _copy_in(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    unsigned idx = rb->writes & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first >= n) {
+        memcpy(&rb->buf[idx], src, n);
+    }
+    else {
+        memcpy(&rb->buf[idx], src, first);
+        memcpy(rb->buf, src + first, n - first);
+    }
+    rb->writes += n;
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -59,38 +91,39 @@ int tsrb_peek_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned int avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _copy_out(rb, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
+    unsigned int avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _copy_out(rb, dst, n);
     irq_restore(irq_state);
-    return idx;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    unsigned int avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -107,12 +140,12 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned int free = rb->size - rb->writes + rb->reads;
+    if (n > free) {
+        n = free;
     }
+    _copy_in(rb, src, n);
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
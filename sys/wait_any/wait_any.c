@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_wait_any
+ * @{
+ *
+ * @file
+ * @brief       Wait on multiple sources implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "wait_any.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* must be called with interrupts disabled, returns the flag notifying the
+ * caller about the source */
+static thread_flags_t _register(const wait_any_src_t *src, thread_t *me)
+{
+    switch (src->type) {
+    case WAIT_ANY_FLAGS:
+        return src->flags;
+    case WAIT_ANY_MSG:
+        return THREAD_FLAG_MSG_WAITING;
+    case WAIT_ANY_MBOX:
+        assert(!src->mbox->notify || (src->mbox->notify == me));
+        mbox_set_notify(src->mbox, me, THREAD_FLAG_WAIT_ANY);
+        return THREAD_FLAG_WAIT_ANY;
+    case WAIT_ANY_SEMA:
+        assert(!src->sema->waiter || (src->sema->waiter == me));
+        src->sema->waiter = me;
+        return THREAD_FLAG_WAIT_ANY;
+    case WAIT_ANY_EVENT:
+        assert(src->queue->waiter == me);
+        return THREAD_FLAG_EVENT;
+    }
+
+    assert(0);
+    return 0;
+}
+
+/* must be called with interrupts disabled */
+static void _unregister(const wait_any_src_t *src)
+{
+    switch (src->type) {
+    case WAIT_ANY_MBOX:
+        mbox_set_notify(src->mbox, NULL, 0);
+        break;
+    case WAIT_ANY_SEMA:
+        src->sema->waiter = NULL;
+        break;
+    default:
+        break;
+    }
+}
+
+/* must be called with interrupts disabled */
+static bool _ready(const wait_any_src_t *src, thread_t *me)
+{
+    switch (src->type) {
+    case WAIT_ANY_FLAGS:
+        return me->flags & src->flags;
+    case WAIT_ANY_MSG:
+        /* queued messages or senders blocked on the calling thread */
+        return (msg_avail() > 0) || (me->msg_waiters.next != NULL);
+    case WAIT_ANY_MBOX:
+        return mbox_avail(src->mbox) > 0;
+    case WAIT_ANY_SEMA:
+        return (src->sema->value > 0) || (src->sema->state != SEMA_OK);
+    case WAIT_ANY_EVENT:
+        return src->queue->event_list.next != NULL;
+    }
+
+    return false;
+}
+
+size_t wait_any(const wait_any_src_t *srcs, size_t numof)
+{
+    assert(srcs && numof);
+
+    thread_t *me = thread_get_active();
+    thread_flags_t mask = 0;
+    thread_flags_t user = 0;
+    unsigned state = irq_disable();
+
+    for (size_t i = 0; i < numof; i++) {
+        mask |= _register(&srcs[i], me);
+        if (srcs[i].type == WAIT_ANY_FLAGS) {
+            user |= srcs[i].flags;
+        }
+    }
+
+    while (1) {
+        /* Notifications are only hints to re-check the sources, the thread
+         * flags the caller waits for are left for the caller to clear.
+         * Anything becoming ready after this point sets a flag again. */
+        me->flags &= ~(mask & ~user);
+
+        for (size_t i = 0; i < numof; i++) {
+            if (_ready(&srcs[i], me)) {
+                for (size_t j = 0; j < numof; j++) {
+                    _unregister(&srcs[j]);
+                }
+                irq_restore(state);
+                DEBUG("wait_any: source %u ready\n", (unsigned)i);
+                return i;
+            }
+        }
+
+        /* Block like thread_flags_wait_any(), but without consuming the
+         * flags, so user flags stay set for the caller. */
+        me->wait_data = (void *)(uintptr_t)mask;
+        sched_set_status(me, STATUS_FLAG_BLOCKED_ANY);
+        irq_restore(state);
+        thread_yield_higher();
+        state = irq_disable();
+    }
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare regular and lock-free multi-producer event queues
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "event.h"
+#include "event/mpsc.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#ifndef TEST_EVENTS
+#define TEST_EVENTS         (1000U)
+#endif
+
+#ifndef TEST_PERIOD_US
+#define TEST_PERIOD_US      (1000U)
+#endif
+
+#define THREAD_FLAG_DONE    (0x2)
+
+typedef struct {
+    event_t super;
+    uint32_t stamp;
+} stamped_event_t;
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    unsigned count;
+} stats_t;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mpsc[THREAD_STACKSIZE_DEFAULT];
+static char _stack_flags[THREAD_STACKSIZE_DEFAULT];
+
+static event_queue_t _queue = EVENT_QUEUE_INIT_DETACHED;
+static event_mpsc_queue_t _mpsc;
+static event_queue_t _bench_queue;
+static event_mpsc_queue_t _bench_mpsc;
+
+typedef enum {
+    MODE_EVENT_POST,
+    MODE_EVENT_MPSC_POST,
+    MODE_THREAD_FLAGS_SET,
+} bench_mode_t;
+
+static thread_t *_main;
+static thread_t *_flags_thread;
+static stats_t _stats;
+static bench_mode_t _mode;
+static uint32_t _isr_max;
+static ztimer_t _timer;
+
+static void _nop(event_t *ev)
+{
+    (void)ev;
+}
+
+static void _stats_reset(void)
+{
+    _stats = (stats_t){ .min = UINT32_MAX };
+}
+
+static void _account(uint32_t stamp)
+{
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - stamp;
+
+    if (latency < _stats.min) {
+        _stats.min = latency;
+    }
+    if (latency > _stats.max) {
+        _stats.max = latency;
+    }
+    _stats.sum += latency;
+    if (++_stats.count == TEST_EVENTS) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+    else {
+        /* post the next event only once this one was handled, so that it is
+         * never dropped as still queued under load */
+        ztimer_set(ZTIMER_USEC, &_timer, TEST_PERIOD_US);
+    }
+}
+
+static void _handler(event_t *ev)
+{
+    _account(container_of(ev, stamped_event_t, super)->stamp);
+}
+
+static stamped_event_t _event = { .super.handler = _handler };
+
+static void _timer_cb(void *arg)
+{
+    (void)arg;
+
+    uint32_t time;
+
+    _event.stamp = ztimer_now(ZTIMER_USEC);
+    switch (_mode) {
+        case MODE_EVENT_POST:
+            event_post(&_queue, &_event.super);
+            break;
+        case MODE_EVENT_MPSC_POST:
+            event_mpsc_post(&_mpsc, &_event.super);
+            break;
+        case MODE_THREAD_FLAGS_SET:
+            thread_flags_set(_flags_thread, THREAD_FLAG_EVENT);
+            break;
+    }
+    time = ztimer_now(ZTIMER_USEC) - _event.stamp;
+    if (time > _isr_max) {
+        _isr_max = time;
+    }
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+
+    return NULL;
+}
+
+static void *_thread_mpsc(void *arg)
+{
+    (void)arg;
+
+    event_mpsc_queue_init(&_mpsc);
+    event_mpsc_loop(&_mpsc);
+
+    return NULL;
+}
+
+/* wakes like the event threads do, but without any queue */
+static void *_thread_flags(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+        _account(_event.stamp);
+    }
+
+    return NULL;
+}
+
+static uint32_t _run_latency(const char *name, bench_mode_t mode)
+{
+    _stats_reset();
+    _isr_max = 0;
+    _mode = mode;
+    ztimer_set(ZTIMER_USEC, &_timer, TEST_PERIOD_US);
+    thread_flags_wait_any(THREAD_FLAG_DONE);
+
+    printf("%s: latency min %" PRIu32 "us avg %" PRIu32 "us max %" PRIu32
+           "us\n", name, _stats.min, _stats.sum / _stats.count, _stats.max);
+    return _isr_max;
+}
+
+static uint32_t _max_post_time(bool use_mpsc)
+{
+    static event_t ev = { .handler = _nop };
+    uint32_t max = 0;
+
+    for (unsigned long i = 0; i < BENCH_RUNS; i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        if (use_mpsc) {
+            event_mpsc_post(&_bench_mpsc, &ev);
+        }
+        else {
+            event_post(&_bench_queue, &ev);
+        }
+
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        if (time > max) {
+            max = time;
+        }
+        if (use_mpsc) {
+            event_mpsc_get(&_bench_mpsc);
+        }
+        else {
+            event_get(&_bench_queue);
+        }
+    }
+
+    return max;
+}
+
+int main(void)
+{
+    puts("event queue vs. lock-free multi-producer event queue\n");
+
+    _main = thread_get_active();
+    event_queue_init(&_bench_queue);
+    event_mpsc_queue_init(&_bench_mpsc);
+
+    event_t ev = { .handler = _nop };
+
+    BENCHMARK_FUNC("event_post()/event_get()", BENCH_RUNS,
+                   (event_post(&_bench_queue, &ev), event_get(&_bench_queue)));
+    BENCHMARK_FUNC("event_mpsc_post()/event_mpsc_get()", BENCH_RUNS,
+                   (event_mpsc_post(&_bench_mpsc, &ev),
+                    event_mpsc_get(&_bench_mpsc)));
+    puts("");
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _thread, NULL, "event");
+    thread_create(_stack_mpsc, sizeof(_stack_mpsc), THREAD_PRIORITY_MAIN - 1, 0,
+                  _thread_mpsc, NULL, "event_mpsc");
+    _flags_thread = thread_get(
+        thread_create(_stack_flags, sizeof(_stack_flags),
+                      THREAD_PRIORITY_MAIN - 1, 0, _thread_flags, NULL,
+                      "flags"));
+    _timer.callback = _timer_cb;
+
+    uint32_t isr_post = _run_latency("event_post()", MODE_EVENT_POST);
+    uint32_t isr_mpsc = _run_latency("event_mpsc_post()",
+                                     MODE_EVENT_MPSC_POST);
+    uint32_t isr_wake = _run_latency("thread_flags_set()",
+                                     MODE_THREAD_FLAGS_SET);
+    puts("");
+
+    printf("event_post(): in ISR max %" PRIu32 "us\n", isr_post);
+    printf("event_mpsc_post(): in ISR max %" PRIu32 "us\n", isr_mpsc);
+    printf("thread_flags_set(): in ISR max %" PRIu32 "us\n", isr_wake);
+    puts("");
+
+    printf("event_post(): max post time %" PRIu32 "us\n", _max_post_time(false));
+    printf("event_mpsc_post(): max post time %" PRIu32 "us\n",
+           _max_post_time(true));
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
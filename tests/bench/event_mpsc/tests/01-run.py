@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 30
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+LATENCY_REGEXP = r"{func}: latency min \d+us avg \d+us max \d+us"
+ISR_REGEXP = r"{func}: in ISR max \d+us"
+POST_REGEXP = r"{func}: max post time \d+us"
+
+
+def testfunc(child):
+    child.expect_exact('event queue vs. lock-free multi-producer event queue')
+    child.expect(BENCHMARK_REGEXP.format(func=r"event_post\(\)/event_get\(\)"),
+                 timeout=TIMEOUT)
+    child.expect(BENCHMARK_REGEXP.format(func=r"event_mpsc_post\(\)/event_mpsc_get\(\)"),
+                 timeout=TIMEOUT)
+    for func in (r"event_post\(\)", r"event_mpsc_post\(\)",
+                 r"thread_flags_set\(\)"):
+        child.expect(LATENCY_REGEXP.format(func=func), timeout=TIMEOUT)
+    for func in (r"event_post\(\)", r"event_mpsc_post\(\)",
+                 r"thread_flags_set\(\)"):
+        child.expect(ISR_REGEXP.format(func=func), timeout=TIMEOUT)
+    for func in (r"event_post\(\)", r"event_mpsc_post\(\)"):
+        child.expect(POST_REGEXP.format(func=func), timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
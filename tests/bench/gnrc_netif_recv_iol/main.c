@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the Ethernet receive path with and without recv_iol()
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+static const uint16_t _frame_sizes[] = { 64, 512, ETHERNET_FRAME_LEN };
+
+static uint8_t _frame[ETHERNET_FRAME_LEN];
+static size_t _frame_len;
+/* where the driver wrote the first byte after the Ethernet header */
+static void *_payload_dst;
+static size_t _copied;
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_t _dev;
+
+static int _init(netdev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static void _isr(netdev_t *dev)
+{
+    (void)dev;
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    (void)iolist;
+    return -ENOTSUP;
+}
+
+static int _recv(netdev_t *dev, void *buf, size_t len, void *info)
+{
+    (void)dev;
+    (void)info;
+
+    if (buf == NULL) {
+        /* size query or drop */
+        return _frame_len;
+    }
+    if (len < _frame_len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, _frame_len);
+    _payload_dst = (uint8_t *)buf + sizeof(ethernet_hdr_t);
+    _copied += _frame_len;
+    return _frame_len;
+}
+
+static int _recv_iol(netdev_t *dev, const iolist_t *iolist, void *info)
+{
+    (void)dev;
+    (void)info;
+    size_t pos = 0;
+
+    for (; iolist && (pos < _frame_len); iolist = iolist->iol_next) {
+        size_t len = _frame_len - pos;
+
+        if (len > iolist->iol_len) {
+            len = iolist->iol_len;
+        }
+        if (pos == sizeof(ethernet_hdr_t)) {
+            _payload_dst = iolist->iol_base;
+        }
+        memcpy(iolist->iol_base, &_frame[pos], len);
+        pos += len;
+    }
+    if (pos < _frame_len) {
+        return -ENOBUFS;
+    }
+    _copied += _frame_len;
+    return _frame_len;
+}
+
+static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
+{
+    (void)dev;
+
+    switch (opt) {
+        case NETOPT_DEVICE_TYPE:
+            assert(max_len == sizeof(uint16_t));
+            *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+            return sizeof(uint16_t);
+        case NETOPT_MAX_PDU_SIZE:
+            assert(max_len == sizeof(uint16_t));
+            *((uint16_t *)value) = ETHERNET_DATA_LEN;
+            return sizeof(uint16_t);
+        case NETOPT_ADDRESS:
+            assert(max_len >= ETHERNET_ADDR_LEN);
+            memcpy(value, &_frame[0], ETHERNET_ADDR_LEN);
+            return ETHERNET_ADDR_LEN;
+        default:
+            return -ENOTSUP;
+    }
+}
+
+static int _set(netdev_t *dev, netopt_t opt, const void *value, size_t len)
+{
+    (void)dev;
+    (void)opt;
+    (void)value;
+    (void)len;
+    return -ENOTSUP;
+}
+
+static const netdev_driver_t _driver_flat = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
+
+static const netdev_driver_t _driver_iol = {
+    .send = _send,
+    .recv = _recv,
+    .recv_iol = _recv_iol,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
+
+static bool _run(const char *name, const netdev_driver_t *driver)
+{
+    size_t moved = 0;
+    uint32_t start, time;
+
+    _dev.driver = driver;
+    _copied = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned long i = 0; i < BENCH_RUNS; i++) {
+        gnrc_pktsnip_t *pkt = _netif.ops->recv(&_netif);
+
+        if (pkt == NULL) {
+            printf("%s: receive failed\n", name);
+            return false;
+        }
+        if (pkt->data != _payload_dst) {
+            /* the packet buffer moved the header and the payload */
+            moved += _frame_len;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%s, %u byte frame: %" PRIu32 "ns per frame, %u bytes copied by "
+           "the driver, %u bytes moved by the packet buffer\n", name,
+           (unsigned)_frame_len, (uint32_t)((time * 1000ULL) / BENCH_RUNS),
+           (unsigned)(_copied / BENCH_RUNS), (unsigned)(moved / BENCH_RUNS));
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)_frame;
+
+    puts("netif receive path with and without recv_iol()\n");
+
+    memset(_frame, 0x55, sizeof(_frame));
+    hdr->dst[0] = 0x02;
+    hdr->src[0] = 0x06;
+    hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+
+    _dev.driver = &_driver_flat;
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   GNRC_NETIF_PRIO, "mock", &_dev) < 0) {
+        puts("cannot create the netif");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_frame_sizes); i++) {
+        _frame_len = _frame_sizes[i];
+        ok &= _run("recv    ", &_driver_flat);
+        ok &= _run("recv_iol", &_driver_iol);
+    }
+
+    puts(ok ? "\n[SUCCESS]" : "\n[FAILED]");
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 30
+RESULT_REGEXP = r"{mode}, \d+ byte frame: \d+ns per frame, \d+ bytes copied " \
+                r"by the driver, (\d+) bytes moved by the packet buffer"
+
+
+def testfunc(child):
+    child.expect_exact("netif receive path with and without recv_iol()")
+    for _ in range(3):
+        child.expect(RESULT_REGEXP.format(mode="recv    "), timeout=TIMEOUT)
+        child.expect(RESULT_REGEXP.format(mode="recv_iol"), timeout=TIMEOUT)
+        # the scatter receive must not move any payload
+        assert int(child.match.group(1)) == 0
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer throughput with and without per-thread caches
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef NETIF_NUMOF
+#define NETIF_NUMOF         (3U)
+#endif
+
+#ifndef TEST_DURATION_MS
+#define TEST_DURATION_MS    (2000U)
+#endif
+
+#define PAYLOAD_SIZE        (80U)
+#define IPV6_HDR_SIZE       (40U)
+#ifndef RX_PERIOD_US
+#define RX_PERIOD_US        (500U)
+#endif
+
+#define QUEUE_SIZE          (2U)
+#define THREAD_FLAG_RX      (0x1)
+
+static char _netif_stacks[NETIF_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static char _ipv6_stack[THREAD_STACKSIZE_DEFAULT];
+static char _rx_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _ipv6_queue[QUEUE_SIZE];
+static msg_t _main_queue[QUEUE_SIZE];
+
+static kernel_pid_t _ipv6_pid;
+static kernel_pid_t _main_pid;
+static unsigned _failed;
+static thread_t *_rx_thread;
+static ztimer_t _rx_timer;
+static uint32_t _rx_max;
+static uint32_t _rx_sum;
+static unsigned _rx_count;
+
+static void *_netif(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_SIZE,
+                                              GNRC_NETTYPE_UNDEF);
+
+        if (pkt == NULL) {
+            _failed++;
+            thread_yield();
+            continue;
+        }
+
+        msg_t msg = { .content.ptr = pkt };
+
+        msg_send(&msg, _ipv6_pid);
+    }
+
+    return NULL;
+}
+
+static void _rx_cb(void *arg)
+{
+    (void)arg;
+
+    thread_flags_set(_rx_thread, THREAD_FLAG_RX);
+    ztimer_set(ZTIMER_USEC, &_rx_timer, RX_PERIOD_US);
+}
+
+/* high priority receiver woken by a timer, may preempt the other threads
+ * while they hold the packet buffer mutex */
+static void *_rx(void *arg)
+{
+    (void)arg;
+
+    _rx_timer.callback = _rx_cb;
+    ztimer_set(ZTIMER_USEC, &_rx_timer, RX_PERIOD_US);
+    while (1) {
+        thread_flags_wait_any(THREAD_FLAG_RX);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_SIZE,
+                                              GNRC_NETTYPE_UNDEF);
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        if (pkt == NULL) {
+            _failed++;
+            continue;
+        }
+        if (time > _rx_max) {
+            _rx_max = time;
+        }
+        _rx_sum += time;
+        _rx_count++;
+        gnrc_pktbuf_release(pkt);
+    }
+
+    return NULL;
+}
+
+static void *_ipv6(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_ipv6_queue, QUEUE_SIZE);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(msg.content.ptr, NULL,
+                                              IPV6_HDR_SIZE,
+                                              GNRC_NETTYPE_UNDEF);
+
+        if (pkt == NULL) {
+            _failed++;
+            gnrc_pktbuf_release(msg.content.ptr);
+            continue;
+        }
+        msg.content.ptr = pkt;
+        msg_send(&msg, _main_pid);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    unsigned count = 0;
+
+    printf("packet buffer cache: %s\n",
+           IS_USED(MODULE_GNRC_PKTBUF_CACHE) ? "on" : "off");
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    _ipv6_pid = thread_create(_ipv6_stack, sizeof(_ipv6_stack),
+                              THREAD_PRIORITY_MAIN - 1, 0, _ipv6, NULL,
+                              "ipv6");
+    _rx_thread = thread_get(thread_create(_rx_stack, sizeof(_rx_stack),
+                                          THREAD_PRIORITY_MAIN - 2, 0, _rx,
+                                          NULL, "rx"));
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        thread_create(_netif_stacks[i], sizeof(_netif_stacks[i]),
+                      THREAD_PRIORITY_MAIN, 0, _netif, NULL, "netif");
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    uint32_t duration;
+
+    while ((duration = ztimer_now(ZTIMER_MSEC) - start) < TEST_DURATION_MS) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        gnrc_pktbuf_release(msg.content.ptr);
+        count++;
+    }
+
+    printf("%u packets in %" PRIu32 "ms (%" PRIu32 " packets/s), "
+           "%u failed allocations\n", count, duration,
+           (uint32_t)((uint64_t)count * 1000 / duration), _failed);
+    printf("high priority allocation: %u calls, avg %" PRIu32 "us, "
+           "max %" PRIu32 "us\n", _rx_count, _rx_sum / _rx_count, _rx_max);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 30
+
+
+def testfunc(child):
+    child.expect(r"packet buffer cache: (on|off)")
+    child.expect(r"\d+ packets in \d+ms \(\d+ packets/s\), \d+ failed allocations",
+                 timeout=TIMEOUT)
+    child.expect(r"high priority allocation: \d+ calls, avg \d+us, max \d+us")
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk transfer throughput of GNRC TCP in both directions
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "modules.h"
+#include "msg.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+/* timeout of a single gnrc_tcp_send() call in milliseconds */
+#define SEND_TIMEOUT_MS     (10000U)
+/* timeout of a single receive call in milliseconds */
+#define RECV_TIMEOUT_MS     (10000U)
+/* must be a multiple of 256 to send a contiguous pattern from it */
+#define CHUNK_SIZE          (2048U)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _chunk[CHUNK_SIZE + 256];
+
+static int _tput_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    uint32_t total;
+    uint32_t sent = 0;
+    uint32_t start, duration;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%iface]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    total = strtoul(argv[2], NULL, 10);
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: gnrc_tcp_open() failed with %d\n", argv[0], res);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    while (sent < total) {
+        /* byte k of the stream has the value (k & 0xff) */
+        size_t len = total - sent;
+        ssize_t ret;
+
+        if (len > CHUNK_SIZE) {
+            len = CHUNK_SIZE;
+        }
+        ret = gnrc_tcp_send(&_tcb, _chunk + (sent & 0xff), len, SEND_TIMEOUT_MS);
+        if (ret <= 0) {
+            printf("%s: gnrc_tcp_send() failed with %d after %" PRIu32 " bytes\n",
+                   argv[0], (int)ret, sent);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += ret;
+    }
+    /* stop before closing, the active close waits in TIME_WAIT */
+    duration = ztimer_now(ZTIMER_MSEC) - start;
+    gnrc_tcp_close(&_tcb);
+    if (duration == 0) {
+        duration = 1;
+    }
+
+    printf("%s: %" PRIu32 " bytes in %" PRIu32 " ms (%" PRIu32 " kbit/s)\n",
+           argv[0], sent, duration, (uint32_t)(((uint64_t)sent * 8) / duration));
+    return 0;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+static ssize_t _recv_check(uint32_t *rcvd)
+{
+    void *data, *ctx = NULL;
+    ssize_t res, total = 0;
+
+    while ((res = gnrc_tcp_recv_buf(&_tcb, &data, &ctx, RECV_TIMEOUT_MS)) > 0) {
+        for (ssize_t i = 0; i < res; i++) {
+            if (((uint8_t *)data)[i] != ((*rcvd + i) & 0xff)) {
+                gnrc_tcp_recv_buf(&_tcb, &data, &ctx, 0);
+                return -EBADMSG;
+            }
+        }
+        *rcvd += res;
+        total += res;
+    }
+    return (res < 0) ? res : total;
+}
+#else
+static ssize_t _recv_check(uint32_t *rcvd)
+{
+    ssize_t res = gnrc_tcp_recv(&_tcb, _chunk, CHUNK_SIZE, RECV_TIMEOUT_MS);
+
+    for (ssize_t i = 0; i < res; i++) {
+        if (_chunk[i] != ((*rcvd + i) & 0xff)) {
+            return -EBADMSG;
+        }
+    }
+    if (res > 0) {
+        *rcvd += res;
+    }
+    return res;
+}
+#endif
+
+static int _tget_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    uint32_t rcvd = 0;
+    uint32_t start, duration;
+    ssize_t res;
+
+    if (argc < 2) {
+        printf("usage: %s <[addr%%iface]:port>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint %s\n", argv[0], argv[1]);
+        return 1;
+    }
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: gnrc_tcp_open() failed with %d\n", argv[0], (int)res);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    /* the server sends the pattern and closes the connection, a return value
+     * of 0 signals that all data was received */
+    while ((res = _recv_check(&rcvd)) > 0) {}
+    duration = ztimer_now(ZTIMER_MSEC) - start;
+    gnrc_tcp_close(&_tcb);
+    if (res < 0) {
+        printf("%s: receiving failed with %d after %" PRIu32 " bytes\n",
+               argv[0], (int)res, rcvd);
+        return 1;
+    }
+    if (duration == 0) {
+        duration = 1;
+    }
+
+    printf("%s: %" PRIu32 " bytes in %" PRIu32 " ms (%" PRIu32 " kbit/s)\n",
+           argv[0], rcvd, duration, (uint32_t)(((uint64_t)rcvd * 8) / duration));
+    return 0;
+}
+
+static const shell_command_t _shell_commands[] = {
+    { "tput", "send bulk data to a TCP server and measure throughput", _tput_cmd },
+    { "tget", "receive bulk data from a TCP server and measure throughput", _tget_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_chunk); i++) {
+        _chunk[i] = i & 0xff;
+    }
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    printf("gnrc_tcp throughput: MSS %u, retransmit queue size %u, "
+           "congestion control %s, receive window %u, zero-copy receive %s, "
+           "packet trains %s\n",
+           (unsigned)CONFIG_GNRC_TCP_MSS,
+           (unsigned)CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE,
+           IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) ? "on" : "off",
+           (unsigned)CONFIG_GNRC_TCP_DEFAULT_WINDOW,
+           IS_USED(MODULE_GNRC_TCP_RECV_BUF) ? "on" : "off",
+           IS_USED(MODULE_GNRC_NETAPI_TRAIN) ? "on" : "off");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
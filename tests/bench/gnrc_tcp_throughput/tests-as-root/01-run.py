@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import struct
+import sys
+import threading
+import time
+
+from testrunner import run
+
+PORT = 8000
+TOTAL_BYTES = 200000
+# the host sends segments of this size in the small segment phase, so many
+# more segments are in flight than RIOT queues with gnrc_tcp_recv_buf
+SMALL_MSS = 100
+SMALL_TOTAL_BYTES = 20000
+
+
+def get_host_interface():
+    # Use the bridge if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    result = os.popen('bridge link show dev {}'.format(tap))
+    bridge = re.search('master (.*) state', result.read())
+    return bridge.group(1).strip() if bridge else tap
+
+
+def get_host_address(interface):
+    result = os.popen('ip addr show dev ' + interface + ' scope link')
+    return re.search('inet6 (.*)/64', result.read()).group(1).strip()
+
+
+def get_riot_interface(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1).strip()
+
+
+class Receiver(threading.Thread):
+    def __init__(self, sock):
+        super().__init__(daemon=True)
+        self.sock = sock
+        self.received = 0
+        self.valid = True
+
+    def run(self):
+        conn, _ = self.sock.accept()
+        with conn:
+            while True:
+                data = conn.recv(65536)
+                if not data:
+                    break
+                for i, byte in enumerate(data):
+                    if byte != (self.received + i) & 0xff:
+                        self.valid = False
+                        break
+                self.received += len(data)
+
+
+class Sender(threading.Thread):
+    def __init__(self, sock, total):
+        super().__init__(daemon=True)
+        self.sock = sock
+        self.data = bytes(i & 0xff for i in range(total))
+
+    def run(self):
+        conn, _ = self.sock.accept()
+        with conn:
+            conn.sendall(self.data)
+
+
+class SmallSender(Sender):
+    def __init__(self, sock, total):
+        super().__init__(sock, total)
+        self.retrans = None
+
+    def run(self):
+        conn, _ = self.sock.accept()
+        with conn:
+            conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            conn.sendall(self.data)
+            # wait until everything is acknowledged, then count the segments
+            # the host had to send again (tcpi_unacked, tcpi_total_retrans)
+            while True:
+                info = conn.getsockopt(socket.IPPROTO_TCP, socket.TCP_INFO, 104)
+                if struct.unpack_from('I', info, 24)[0] == 0:
+                    break
+                time.sleep(0.01)
+            self.retrans = struct.unpack_from('I', info, 100)[0]
+
+
+def listen(mss=None):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    if mss is not None:
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_MAXSEG, mss)
+    sock.bind(('::', PORT))
+    sock.listen(1)
+    return sock
+
+
+def testfunc(child):
+    child.expect(r'zero-copy receive (\w+)')
+
+    host_iface = get_host_interface()
+    host_addr = get_host_address(host_iface)
+    riot_iface = get_riot_interface(child)
+
+    # RIOT sends to the host
+    sock = listen()
+    receiver = Receiver(sock)
+    receiver.start()
+
+    child.sendline('tput [{}%{}]:{} {}'.format(host_addr, riot_iface, PORT,
+                                              TOTAL_BYTES))
+    child.expect(r'tput: (\d+) bytes in (\d+) ms \((\d+) kbit/s\)')
+    assert int(child.match.group(1)) == TOTAL_BYTES
+
+    receiver.join(10)
+    sock.close()
+    assert not receiver.is_alive()
+    assert receiver.received == TOTAL_BYTES
+    assert receiver.valid
+
+    # RIOT receives from the host
+    sock = listen()
+    sender = Sender(sock, TOTAL_BYTES)
+    sender.start()
+
+    child.sendline('tget [{}%{}]:{}'.format(host_addr, riot_iface, PORT))
+    child.expect(r'tget: (\d+) bytes in (\d+) ms \((\d+) kbit/s\)')
+    assert int(child.match.group(1)) == TOTAL_BYTES
+
+    sender.join(10)
+    sock.close()
+
+    # RIOT receives many small segments in flight, none may be dropped
+    sock = listen(SMALL_MSS)
+    sender = SmallSender(sock, SMALL_TOTAL_BYTES)
+    sender.start()
+
+    child.sendline('tget [{}%{}]:{}'.format(host_addr, riot_iface, PORT))
+    child.expect(r'tget: (\d+) bytes in (\d+) ms \((\d+) kbit/s\)')
+    assert int(child.match.group(1)) == SMALL_TOTAL_BYTES
+
+    sender.join(10)
+    sock.close()
+    assert not sender.is_alive()
+    assert sender.retrans == 0
+    print('[SUCCESS]')
+
+
+if __name__ == '__main__':
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It's constructing and sending Ethernet frames.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc, timeout=60))
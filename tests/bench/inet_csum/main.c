@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the Internet Checksum
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS      (1000U)
+#endif
+
+#define MAX_LEN         (1500U)
+
+static const uint16_t _lens[] = { 20, 64, 576, 1280, MAX_LEN };
+
+static uint8_t _src[MAX_LEN + 1] __attribute__((aligned(4)));
+static uint8_t _dst[MAX_LEN + 1] __attribute__((aligned(4)));
+
+/* one 16-bit word per iteration, the way inet_csum used to do it */
+static uint16_t _ref_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1U); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static int _verify(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        for (unsigned offset = 0; offset < 2; offset++) {
+            uint16_t len = _lens[i] - offset;
+            uint16_t ref = _ref_csum(0, &_src[offset], len);
+
+            memset(_dst, 0, sizeof(_dst));
+            if ((inet_csum(0, &_src[offset], len) != ref) ||
+                (inet_csum_copy(0, &_dst[offset], &_src[offset], len) != ref) ||
+                (memcmp(&_dst[offset], &_src[offset], len) != 0)) {
+                printf("FAIL for %u bytes at offset %u\n", len, offset);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void _bench(uint16_t len, unsigned offset)
+{
+    const uint8_t *src = &_src[offset];
+    uint8_t *dst = &_dst[offset];
+    uint32_t ref_us, csum_us, memcpy_us, copy_us;
+    uint32_t start;
+    /* keep the compiler from dropping the calls */
+    volatile uint16_t sum = 0;
+
+    len -= offset;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        sum = _ref_csum(sum, src, len);
+    }
+    ref_us = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        sum = inet_csum(sum, src, len);
+    }
+    csum_us = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        memcpy(dst, src, len);
+        sum = inet_csum(sum, dst, len);
+    }
+    memcpy_us = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        sum = inet_csum_copy(sum, dst, src, len);
+    }
+    copy_us = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%4u bytes, %s: reference: %" PRIu32 "us, inet_csum: %" PRIu32
+           "us, memcpy + inet_csum: %" PRIu32 "us, inet_csum_copy: %" PRIu32
+           "us\n", len, (offset) ? "odd    " : "aligned", ref_us, csum_us,
+           memcpy_us, copy_us);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_src); i++) {
+        _src[i] = (i * 167) ^ (i >> 3);
+    }
+
+    printf("Verifying inet_csum against reference: ");
+    if (_verify() < 0) {
+        return 1;
+    }
+    puts("OK");
+
+    printf("%u iterations each\n", ITERATIONS);
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        for (unsigned offset = 0; offset < 2; offset++) {
+            _bench(_lens[i], offset);
+        }
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+
+
+def testfunc(child):
+    child.expect_exact("Verifying inet_csum against reference: OK")
+    child.expect(r"\d+ iterations each")
+    for _ in range(10):
+        child.expect(r"\s*\d+ bytes, (aligned|odd\s+): reference: \d+us, "
+                     r"inet_csum: \d+us, memcpy \+ inet_csum: \d+us, "
+                     r"inet_csum_copy: \d+us", timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include <stdatomic.h>
 #include <stdio.h>
+#include "container.h"
 #include "macros/units.h"
 #include "thread.h"
 #include "clk.h"
@@ -32,7 +33,12 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef TEST_BATCH_SIZE
+#define TEST_BATCH_SIZE     (8U)
+#endif
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _stack_batch[THREAD_STACKSIZE_MAIN];
 
 static void _timer_callback(void *_flag)
 {
@@ -52,6 +58,29 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_batch_thread(void *arg)
+{
+    (void)arg;
+    static msg_t queue[2 * TEST_BATCH_SIZE];
+
+    msg_init_queue(queue, ARRAY_SIZE(queue));
+
+    while (1) {
+        msg_t test[TEST_BATCH_SIZE];
+        msg_receive_batch(test, ARRAY_SIZE(test));
+    }
+
+    return NULL;
+}
+
+static void _print_result(uint32_t n)
+{
+    printf("{ \"result\" : %"PRIu32, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
 int main(void)
 {
     puts("main starting");
@@ -63,6 +92,13 @@ int main(void)
                                        _second_thread,
                                        NULL,
                                        "second_thread");
+    kernel_pid_t other_batch = thread_create(_stack_batch,
+                                             sizeof(_stack_batch),
+                                             (THREAD_PRIORITY_MAIN - 1),
+                                             0,
+                                             _batch_thread,
+                                             NULL,
+                                             "batch_thread");
 
     atomic_flag flag = ATOMIC_FLAG_INIT;
     uint32_t n = 0;
@@ -81,10 +117,19 @@ int main(void)
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    _print_result(n);
+
+    printf("batch size: %u\n", TEST_BATCH_SIZE);
+    n = 0;
+    atomic_flag_test_and_set(&flag);
+    xtimer_set(&timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        msg_t test[TEST_BATCH_SIZE];
+        n += msg_send_batch(test, ARRAY_SIZE(test), other_batch);
+    }
+
+    _print_result(n);
 
     return 0;
 }
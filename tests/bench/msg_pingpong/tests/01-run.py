@@ -13,6 +13,8 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r"batch size: \d+")
+    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
 
 
 if __name__ == "__main__":
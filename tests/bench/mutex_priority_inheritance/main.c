@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure worst-case mutex latency under priority inversion
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS                  (20U)
+#endif
+
+#ifndef CRITICAL_SECTION_US
+#define CRITICAL_SECTION_US     (1000U)
+#endif
+
+#ifndef INTERFERENCE_US
+#define INTERFERENCE_US         (10000U)
+#endif
+
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _a = MUTEX_INIT;
+static mutex_t _b = MUTEX_INIT;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static kernel_pid_t _high, _mid;
+static uint32_t _latency_max;
+static bool _nested_ok = true;
+
+static void *_high_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        thread_wakeup(_mid);
+        mutex_lock(&_a);
+
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+
+        if (latency > _latency_max) {
+            _latency_max = latency;
+        }
+        mutex_unlock(&_a);
+    }
+
+    return NULL;
+}
+
+static void *_mid_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        ztimer_spin(ZTIMER_USEC, INTERFERENCE_US);
+    }
+
+    return NULL;
+}
+
+static void *_low_thread(void *arg)
+{
+    (void)arg;
+    thread_t *me = thread_get_active();
+    uint8_t prio = me->priority;
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        mutex_lock(&_a);
+        mutex_lock(&_b);
+        thread_wakeup(_high);
+        ztimer_spin(ZTIMER_USEC, CRITICAL_SECTION_US);
+        mutex_unlock(&_b);
+        if (IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+            && (me->priority != thread_get(_high)->priority)) {
+            /* releasing the nested mutex must not drop the boost */
+            _nested_ok = false;
+        }
+        ztimer_spin(ZTIMER_USEC, CRITICAL_SECTION_US);
+        mutex_unlock(&_a);
+        if (me->priority != prio) {
+            _nested_ok = false;
+        }
+        /* let the medium priority thread finish its round */
+        ztimer_sleep(ZTIMER_USEC, 2 * INTERFERENCE_US);
+    }
+
+    mutex_unlock(&_done);
+    return NULL;
+}
+
+int main(void)
+{
+    printf("mutex latency, priority inheritance: %s\n",
+           IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) ? "on" : "off");
+
+    _high = thread_create(_stack_high, sizeof(_stack_high),
+                          THREAD_PRIORITY_MAIN - 3, 0,
+                          _high_thread, NULL, "high");
+    _mid = thread_create(_stack_mid, sizeof(_stack_mid),
+                         THREAD_PRIORITY_MAIN - 2, 0,
+                         _mid_thread, NULL, "mid");
+    thread_create(_stack_low, sizeof(_stack_low), THREAD_PRIORITY_MAIN - 1, 0,
+                  _low_thread, NULL, "low");
+
+    mutex_lock(&_done);
+
+    printf("{ \"rounds\" : %u, \"critical_section_us\" : %u, "
+           "\"interference_us\" : %u, \"latency_max_us\" : %" PRIu32 " }\n",
+           ROUNDS, 2 * CRITICAL_SECTION_US, INTERFERENCE_US, _latency_max);
+    puts(_nested_ok ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
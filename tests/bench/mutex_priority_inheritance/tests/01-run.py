@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"priority inheritance: (on|off)")
+    pi = child.match.group(1) == "on"
+    child.expect(r"{ \"rounds\" : \d+, \"critical_section_us\" : (\d+), "
+                 r"\"interference_us\" : (\d+), \"latency_max_us\" : (\d+) }",
+                 timeout=30)
+    critical_section = int(child.match.group(1))
+    interference = int(child.match.group(2))
+    latency = int(child.match.group(3))
+    if pi:
+        # the waiting time must not include the medium priority thread
+        assert latency < critical_section + interference / 2, \
+            "latency {} us not bounded by critical section".format(latency)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
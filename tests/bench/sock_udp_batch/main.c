@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of single and batched sock_udp calls over the
+ *              IPv6 loopback
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "modules.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#ifndef DATAGRAMS
+#define DATAGRAMS       (10000U)
+#endif
+
+#define PAYLOAD_LEN     (64U)
+#define PORT            (4711U)
+/* must not exceed the mbox size of a sock, the sender does not wait */
+#define MAX_BATCH       (8U)
+#define RECV_TIMEOUT_US (1000000U)
+
+static const unsigned _batch_sizes[] = { 1, 2, 4, MAX_BATCH };
+
+static sock_udp_t _server, _client;
+static uint8_t _tx_buf[MAX_BATCH][PAYLOAD_LEN];
+static uint8_t _rx_buf[MAX_BATCH][PAYLOAD_LEN];
+static sock_udp_batch_tx_t _tx_msgs[MAX_BATCH];
+static sock_udp_batch_rx_t _rx_msgs[MAX_BATCH];
+
+static int _check(unsigned idx, size_t len)
+{
+    return ((len == PAYLOAD_LEN) &&
+            (memcmp(_rx_buf[idx], _tx_buf[idx], PAYLOAD_LEN) == 0)) ? 0 : -EBADMSG;
+}
+
+/* one sock_udp_send() and sock_udp_recv() per datagram */
+static int _run_single(unsigned batch)
+{
+    for (unsigned sent = 0; sent < DATAGRAMS; sent += batch) {
+        for (unsigned i = 0; i < batch; i++) {
+            ssize_t res = sock_udp_send(&_client, _tx_buf[i], PAYLOAD_LEN, NULL);
+
+            if (res < 0) {
+                return res;
+            }
+        }
+        for (unsigned i = 0; i < batch; i++) {
+            ssize_t res = sock_udp_recv(&_server, _rx_buf[i], PAYLOAD_LEN,
+                                        RECV_TIMEOUT_US, NULL);
+
+            if (res < 0) {
+                return res;
+            }
+            if (_check(i, res) < 0) {
+                return -EBADMSG;
+            }
+        }
+    }
+    return 0;
+}
+
+/* one sock_udp_send_batch() and as few sock_udp_recv_batch() as possible */
+static int _run_batch(unsigned batch)
+{
+    for (unsigned sent = 0; sent < DATAGRAMS; sent += batch) {
+        unsigned rcvd = 0;
+        int res = sock_udp_send_batch(&_client, _tx_msgs, batch);
+
+        if (res < 0) {
+            return res;
+        }
+        else if ((unsigned)res != batch) {
+            return -ENOMEM;
+        }
+        /* the first datagrams can arrive before the stack is done with the
+         * last ones */
+        while (rcvd < batch) {
+            res = sock_udp_recv_batch(&_server, &_rx_msgs[rcvd], batch - rcvd,
+                                      RECV_TIMEOUT_US);
+            if (res < 0) {
+                return res;
+            }
+            rcvd += res;
+        }
+        for (unsigned i = 0; i < batch; i++) {
+            if (_check(i, _rx_msgs[i].len) < 0) {
+                return -EBADMSG;
+            }
+        }
+    }
+    return 0;
+}
+
+static int _bench(const char *name, int (*run)(unsigned), unsigned batch)
+{
+    uint32_t start, duration;
+    int res;
+
+    start = ztimer_now(ZTIMER_USEC);
+    res = run(batch);
+    duration = ztimer_now(ZTIMER_USEC) - start;
+    if (res < 0) {
+        printf("%s, batch size %u: failed with %d\n", name, batch, res);
+        return res;
+    }
+    if (duration == 0) {
+        duration = 1;
+    }
+    printf("%s, batch size %u: %" PRIu32 "us (%" PRIu32 " datagrams/s)\n",
+           name, batch, duration,
+           (uint32_t)(((uint64_t)DATAGRAMS * US_PER_SEC) / duration));
+    return 0;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT };
+
+    local.port = PORT;
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    if ((sock_udp_create(&_server, &local, NULL, 0) < 0) ||
+        (sock_udp_create(&_client, NULL, &remote, 0) < 0)) {
+        puts("Unable to create socks");
+        return 1;
+    }
+    for (unsigned i = 0; i < MAX_BATCH; i++) {
+        for (unsigned j = 0; j < PAYLOAD_LEN; j++) {
+            _tx_buf[i][j] = i + j;
+        }
+        _tx_msgs[i].data = _tx_buf[i];
+        _tx_msgs[i].len = PAYLOAD_LEN;
+        _rx_msgs[i].data = _rx_buf[i];
+        _rx_msgs[i].max_len = PAYLOAD_LEN;
+    }
+
+    printf("%u datagrams of %u bytes each, packet trains %s\n",
+           DATAGRAMS, PAYLOAD_LEN,
+           IS_USED(MODULE_GNRC_NETAPI_TRAIN) ? "on" : "off");
+    for (unsigned i = 0; i < ARRAY_SIZE(_batch_sizes); i++) {
+        if ((_bench("single", _run_single, _batch_sizes[i]) < 0) ||
+            (_bench("batch ", _run_batch, _batch_sizes[i]) < 0)) {
+            return 1;
+        }
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+
+
+def testfunc(child):
+    child.expect(r"\d+ datagrams of \d+ bytes each, packet trains (on|off)")
+    for _ in range(4):
+        for name in ("single", "batch "):
+            child.expect(name + r", batch size \d+: \d+us \(\d+ datagrams/s\)",
+                         timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare job throughput of thread creation and thread pools
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_pool.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define WORKER_PRIO         (THREAD_PRIORITY_MAIN - 1)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static char _stack_filler[THREAD_STACKSIZE_DEFAULT];
+static THREAD_POOL_STACKS(_stacks, THREAD_STACKSIZE_DEFAULT, 2);
+static thread_pool_job_t _jobs[2];
+static thread_pool_t _pool;
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static void _job(void *arg)
+{
+    mutex_unlock(arg);
+}
+
+static void *_thread(void *arg)
+{
+    _job(arg);
+    return NULL;
+}
+
+static void _run_thread_create(void)
+{
+    /* default flags, as a thread created from scratch would use */
+    thread_create(_stack, sizeof(_stack), WORKER_PRIO, 0, _thread, &_done,
+                  "job");
+    mutex_lock(&_done);
+}
+
+static void _run_thread_pool(void)
+{
+    thread_pool_submit(&_pool, _job, &_done);
+    mutex_lock(&_done);
+}
+
+static void _job_block(void *arg)
+{
+    mutex_lock(arg);
+    mutex_unlock(arg);
+}
+
+static void *_filler(void *arg)
+{
+    (void)arg;
+
+    thread_sleep();
+    return NULL;
+}
+
+/* occupies a free thread slot until woken up */
+static kernel_pid_t _fill(char *stack, size_t size)
+{
+    return thread_create(stack, size, WORKER_PRIO, 0, _filler, NULL, "filler");
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    puts("thread creation vs. thread pool\n");
+
+    BENCHMARK_FUNC("thread_create()", BENCH_RUNS, _run_thread_create());
+
+    thread_pool_init(&_pool, _stacks, sizeof(_stacks[0]), ARRAY_SIZE(_stacks),
+                     _jobs, ARRAY_SIZE(_jobs), WORKER_PRIO, 0, "worker");
+    BENCHMARK_FUNC("thread_pool_submit() new worker", BENCH_RUNS,
+                   _run_thread_pool());
+    ok &= (thread_pool_workers(&_pool) == 0);
+
+    /* occupy both workers and fill the queue */
+    mutex_t block = MUTEX_INIT_LOCKED;
+    for (unsigned i = 0; i < ARRAY_SIZE(_stacks) + ARRAY_SIZE(_jobs); i++) {
+        ok &= (thread_pool_submit(&_pool, _job_block, &block) == 0);
+    }
+    ok &= (thread_pool_submit(&_pool, _job_block, &block) == -EAGAIN);
+    ok &= (thread_pool_workers(&_pool) == ARRAY_SIZE(_stacks));
+    ok &= (thread_pool_pending(&_pool) == ARRAY_SIZE(_jobs));
+
+    /* all jobs run to completion, all workers exit */
+    mutex_unlock(&block);
+    ok &= (thread_pool_pending(&_pool) == 0);
+    ok &= (thread_pool_workers(&_pool) == 0);
+
+    /* MAXTHREADS leaves room for a single worker. A job that gets no worker
+     * of its own is run by the busy one. */
+    kernel_pid_t filler = _fill(_stack, sizeof(_stack));
+    mutex_lock(&block);
+    ok &= (thread_pool_submit(&_pool, _job_block, &block) == 0);
+    ok &= (thread_pool_submit(&_pool, _job_block, &block) == 0);
+    ok &= (thread_pool_workers(&_pool) == 1);
+    ok &= (thread_pool_pending(&_pool) == 1);
+    mutex_unlock(&block);
+    ok &= (thread_pool_pending(&_pool) == 0);
+    ok &= (thread_pool_workers(&_pool) == 0);
+
+    /* without any worker, a job that cannot get one is rejected */
+    kernel_pid_t filler2 = _fill(_stack_filler, sizeof(_stack_filler));
+    ok &= (thread_pool_submit(&_pool, _job, &_done) == -EOVERFLOW);
+    ok &= (thread_pool_pending(&_pool) == 0);
+    thread_wakeup(filler2);
+    ok &= (thread_pool_submit(&_pool, _job, &_done) == 0);
+    mutex_lock(&_done);
+    thread_wakeup(filler);
+
+    /* last, as the parked worker stays around and occupies a thread slot */
+    thread_pool_init(&_pool, _stacks, sizeof(_stacks[0]), ARRAY_SIZE(_stacks),
+                     _jobs, ARRAY_SIZE(_jobs), WORKER_PRIO, 1, "worker");
+    BENCHMARK_FUNC("thread_pool_submit() idle worker", BENCH_RUNS,
+                   _run_thread_pool());
+    ok &= (thread_pool_workers(&_pool) == 1);
+
+    puts(ok ? "\n[SUCCESS]" : "\n[FAILED]");
+
+    return 0;
+}
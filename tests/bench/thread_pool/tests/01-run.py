@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for func in ("thread_create()", "thread_pool_submit() new worker",
+                 "thread_pool_submit() idle worker"):
+        child.expect(r"\s+{}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---"
+                     r"\s+\d+ calls per sec".format(func.replace("(", r"\(")
+                                                    .replace(")", r"\)")))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
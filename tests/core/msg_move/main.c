@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for messages with buffer ownership transfer
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "msg_move.h"
+#include "thread.h"
+
+#define BUF_SIZE        (24U)
+#define BUF_NUMOF       (4U)
+#define QUEUE_SIZE      (2U)
+#define MSG_TYPE_DATA   (0x4242)
+#define TEST_PATTERN    "move me"
+
+static uint64_t _pool_mem[MSG_MOVE_POOL_SIZE(BUF_SIZE, BUF_NUMOF) /
+                          sizeof(uint64_t)];
+static msg_move_pool_t _pool;
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static bool _content_ok;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    msg_receive(&m);
+    _content_ok = (m.type == MSG_TYPE_DATA) &&
+                  (msg_move_owner(m.content.ptr) == thread_getpid()) &&
+                  (strcmp(m.content.ptr, TEST_PATTERN) == 0);
+    msg_move_free(m.content.ptr);
+    return NULL;
+}
+
+static void *_queue_and_exit(void *arg)
+{
+    (void)arg;
+    msg_t queue[QUEUE_SIZE];
+
+    msg_init_queue(queue, QUEUE_SIZE);
+    /* let the main thread fill the queue, then exit without receiving */
+    thread_sleep();
+    return NULL;
+}
+
+static void test_msg_move_alloc_free(void)
+{
+    void *bufs[BUF_NUMOF];
+
+    for (unsigned i = 0; i < BUF_NUMOF; i++) {
+        bufs[i] = msg_move_alloc(&_pool);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+        TEST_ASSERT_EQUAL_INT(0, (uintptr_t)bufs[i] % MSG_MOVE_ALIGN);
+        TEST_ASSERT_EQUAL_INT(thread_getpid(), msg_move_owner(bufs[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, msg_move_pool_avail(&_pool));
+    TEST_ASSERT_NULL(msg_move_alloc(&_pool));
+    for (unsigned i = 0; i < BUF_NUMOF; i++) {
+        msg_move_free(bufs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(BUF_NUMOF, msg_move_pool_avail(&_pool));
+}
+
+static void test_msg_move_send(void)
+{
+    msg_t m = { .type = MSG_TYPE_DATA };
+    char *buf = msg_move_alloc(&_pool);
+
+    _content_ok = false;
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _receiver, NULL, "receiver");
+    strcpy(buf, TEST_PATTERN);
+    TEST_ASSERT_EQUAL_INT(1, msg_move_send(&m, pid, buf));
+    TEST_ASSERT(_content_ok);
+    TEST_ASSERT_EQUAL_INT(BUF_NUMOF, msg_move_pool_avail(&_pool));
+}
+
+static void test_msg_move_try_send_overflow(void)
+{
+    msg_t m = { .type = MSG_TYPE_DATA };
+    /* main thread has no message queue and is not receiving */
+    TEST_ASSERT_EQUAL_INT(0, msg_move_try_send(&m, thread_getpid(),
+                                               msg_move_alloc(&_pool)));
+    TEST_ASSERT_EQUAL_INT(BUF_NUMOF, msg_move_pool_avail(&_pool));
+}
+
+static void test_msg_move_receiver_exits(void)
+{
+    msg_t m = { .type = MSG_TYPE_DATA };
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _queue_and_exit, NULL, "queue_and_exit");
+
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(1, msg_move_try_send(&m, pid,
+                                                   msg_move_alloc(&_pool)));
+    }
+    /* queue is full now */
+    TEST_ASSERT_EQUAL_INT(0, msg_move_try_send(&m, pid,
+                                               msg_move_alloc(&_pool)));
+    TEST_ASSERT_EQUAL_INT(BUF_NUMOF - QUEUE_SIZE,
+                          msg_move_pool_avail(&_pool));
+    thread_wakeup(pid);
+    TEST_ASSERT_EQUAL_INT(BUF_NUMOF, msg_move_pool_avail(&_pool));
+}
+
+static Test *tests_msg_move_suite(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_msg_move_alloc_free),
+        new_TestFixture(test_msg_move_send),
+        new_TestFixture(test_msg_move_try_send_overflow),
+        new_TestFixture(test_msg_move_receiver_exits),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_move_pool_init(&_pool, _pool_mem, BUF_SIZE, BUF_NUMOF);
+
+    TESTS_START();
+    TESTS_RUN(tests_msg_move_suite());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for priority inheritance along a chain of
+ *              mutex owners
+ *
+ * The main thread has the lowest priority, so every other thread runs until
+ * it blocks as soon as it is created or woken up:
+ *
+ * - low locks `lock_a` and sleeps
+ * - mid locks `lock_b` and blocks on `lock_a`, boosting low
+ * - high blocks on `lock_b`, boosting mid and, through mid, low
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define PRIO_LOW    (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_MID    (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_HIGH   (THREAD_PRIORITY_MAIN - 3)
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t lock_a = MUTEX_INIT;
+static mutex_t lock_b = MUTEX_INIT;
+static mutex_cancel_t _mc;
+static int _high_res = 1;
+static uint8_t _low_prio_after_unlock;
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&lock_a);
+    thread_sleep();
+    mutex_unlock(&lock_a);
+    _low_prio_after_unlock = thread_get_active()->priority;
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&lock_b);
+    mutex_lock(&lock_a);
+    mutex_unlock(&lock_a);
+    mutex_unlock(&lock_b);
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+
+    _mc = mutex_cancel_init(&lock_b);
+    _high_res = mutex_lock_cancelable(&_mc);
+    return NULL;
+}
+
+int main(void)
+{
+    puts(
+        "Test Application for mutex priority inheritance\n"
+        "===============================================\n"
+    );
+
+    kernel_pid_t low = thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                                     0, _low, NULL, "low");
+    kernel_pid_t mid = thread_create(_stack_mid, sizeof(_stack_mid), PRIO_MID,
+                                     0, _mid, NULL, "mid");
+
+    printf("%s: ", "Boost along the chain");
+    expect(thread_get(low)->priority == PRIO_MID);
+    thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH, 0, _high, NULL,
+                  "high");
+    expect(thread_get(mid)->priority == PRIO_HIGH);
+    expect(thread_get(low)->priority == PRIO_HIGH);
+    puts("OK");
+
+    printf("%s: ", "Cancel undoes the boost along the chain");
+    mutex_cancel(&_mc);
+    expect(_high_res == -ECANCELED);
+    expect(thread_get(mid)->priority == PRIO_MID);
+    expect(thread_get(low)->priority == PRIO_MID);
+    puts("OK");
+
+    printf("%s: ", "Unlock restores the base priority");
+    thread_wakeup(low);
+    expect(_low_prio_after_unlock == PRIO_LOW);
+    expect(mutex_trylock(&lock_a) && mutex_trylock(&lock_b));
+    puts("OK");
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Boost along the chain: OK")
+    child.expect_exact("Cancel undoes the boost along the chain: OK")
+    child.expect_exact("Unlock restores the base priority: OK")
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the IPv6 forwarding fast path
+ *
+ * Received packets are handed to gnrc_ipv6_fastfwd() as the receiving
+ * interface does. Packets that qualify must leave through the mock Ethernet
+ * interface with a decremented hop limit, all others must be left untouched
+ * for the IPv6 thread.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/fastfwd.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NBR_MAC             { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00, }
+#define NBR_LINK_LOCAL      { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+/* neighbor without a neighbor cache entry */
+#define NBR2_LINK_LOCAL     { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x02, }
+#define DST                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DST2                { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xce, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DST_PFX_LEN         (64U)
+#define SRC                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01, \
+                              0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x01, }
+#define HOP_LIMIT           (64U)
+#define PAYLOAD_LEN         (16U)
+#define SEND_TIMEOUT_MS     (10U)
+
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _nbr_link_local = { .u8 = NBR_LINK_LOCAL };
+static const ipv6_addr_t _nbr2_link_local = { .u8 = NBR2_LINK_LOCAL };
+static const ipv6_addr_t _dst = { .u8 = DST };
+static const ipv6_addr_t _dst2 = { .u8 = DST2 };
+static const ipv6_addr_t _src = { .u8 = SRC };
+
+static msg_t _main_queue[2];
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+/* last forwarded UDP frame, other frames (e.g. neighbor solicitations) are
+ * ignored */
+static uint8_t _frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) +
+                      PAYLOAD_LEN];
+static unsigned _frames;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[sizeof(_frame)];
+    size_t len = 0;
+
+    (void)dev;
+    for (; iolist; iolist = iolist->iol_next) {
+        if ((len + iolist->iol_len) > sizeof(frame)) {
+            return -ENOBUFS;
+        }
+        memcpy(&frame[len], iolist->iol_base, iolist->iol_len);
+        len += iolist->iol_len;
+    }
+    if ((len == sizeof(frame)) &&
+        (((ipv6_hdr_t *)&frame[sizeof(ethernet_hdr_t)])->nh == PROTNUM_UDP)) {
+        memcpy(_frame, frame, sizeof(frame));
+        _frames++;
+    }
+    return len;
+}
+
+static gnrc_pktsnip_t *_build_recvd_pkt(const ipv6_addr_t *dst, uint8_t nh,
+                                        uint8_t hl)
+{
+    gnrc_pktsnip_t *netif, *pkt;
+    ipv6_hdr_t *hdr;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    expect(netif);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    pkt = gnrc_pktbuf_add(netif, NULL, sizeof(ipv6_hdr_t) + PAYLOAD_LEN,
+                          GNRC_NETTYPE_IPV6);
+    expect(pkt);
+    hdr = pkt->data;
+    memset(hdr, 0x55, pkt->size);
+    ipv6_hdr_set_version(hdr);
+    hdr->v_tc_fl = byteorder_htonl(0x60000000);
+    hdr->len = byteorder_htons(PAYLOAD_LEN);
+    hdr->nh = nh;
+    hdr->hl = hl;
+    hdr->src = _src;
+    hdr->dst = *dst;
+    return pkt;
+}
+
+/* checks a packet the fast path did not take is still the received one */
+static void _expect_untouched(gnrc_pktsnip_t *pkt, uint8_t hl)
+{
+    TEST_ASSERT(pkt->type == GNRC_NETTYPE_IPV6);
+    TEST_ASSERT_EQUAL_INT(sizeof(ipv6_hdr_t) + PAYLOAD_LEN, pkt->size);
+    TEST_ASSERT_EQUAL_INT(hl, ((ipv6_hdr_t *)pkt->data)->hl);
+    TEST_ASSERT_NOT_NULL(pkt->next);
+    TEST_ASSERT(pkt->next->type == GNRC_NETTYPE_NETIF);
+    TEST_ASSERT_NULL(pkt->next->next);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void set_up(void)
+{
+    _frames = 0;
+}
+
+static void tear_down(void)
+{
+    /* let the interface finish sending */
+    ztimer_sleep(ZTIMER_MSEC, SEND_TIMEOUT_MS);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_fastfwd(void)
+{
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)_frame;
+    ipv6_hdr_t *hdr = (ipv6_hdr_t *)&_frame[sizeof(ethernet_hdr_t)];
+
+    TEST_ASSERT(gnrc_ipv6_fastfwd(_build_recvd_pkt(&_dst, PROTNUM_UDP,
+                                                   HOP_LIMIT)));
+    ztimer_sleep(ZTIMER_MSEC, SEND_TIMEOUT_MS);
+    TEST_ASSERT_EQUAL_INT(1, _frames);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(eth->dst, _nbr_mac, sizeof(_nbr_mac)));
+    TEST_ASSERT_EQUAL_INT(ETHERTYPE_IPV6, byteorder_ntohs(eth->type));
+    TEST_ASSERT_EQUAL_INT(HOP_LIMIT - 1, hdr->hl);
+    TEST_ASSERT(ipv6_addr_equal(&hdr->src, &_src));
+    TEST_ASSERT(ipv6_addr_equal(&hdr->dst, &_dst));
+    TEST_ASSERT_EQUAL_INT(PAYLOAD_LEN, byteorder_ntohs(hdr->len));
+}
+
+static void test_fastfwd__hop_limit_expires(void)
+{
+    gnrc_pktsnip_t *pkt = _build_recvd_pkt(&_dst, PROTNUM_UDP, 1);
+
+    TEST_ASSERT(!gnrc_ipv6_fastfwd(pkt));
+    _expect_untouched(pkt, 1);
+    pkt = _build_recvd_pkt(&_dst, PROTNUM_UDP, 0);
+    TEST_ASSERT(!gnrc_ipv6_fastfwd(pkt));
+    _expect_untouched(pkt, 0);
+}
+
+static void test_fastfwd__hop_by_hop(void)
+{
+    gnrc_pktsnip_t *pkt = _build_recvd_pkt(&_dst, PROTNUM_IPV6_EXT_HOPOPT,
+                                           HOP_LIMIT);
+
+    TEST_ASSERT(!gnrc_ipv6_fastfwd(pkt));
+    _expect_untouched(pkt, HOP_LIMIT);
+}
+
+static void test_fastfwd__next_hop_unresolved(void)
+{
+    gnrc_pktsnip_t *pkt = _build_recvd_pkt(&_dst2, PROTNUM_UDP, HOP_LIMIT);
+
+    TEST_ASSERT(!gnrc_ipv6_fastfwd(pkt));
+    _expect_untouched(pkt, HOP_LIMIT);
+}
+
+static void test_fastfwd__subscriber(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(
+                                        GNRC_NETREG_DEMUX_CTX_ALL,
+                                        thread_getpid());
+    gnrc_pktsnip_t *pkt = _build_recvd_pkt(&_dst, PROTNUM_UDP, HOP_LIMIT);
+
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &entry);
+    TEST_ASSERT(!gnrc_ipv6_fastfwd(pkt));
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &entry);
+    _expect_untouched(pkt, HOP_LIMIT);
+}
+
+static Test *tests_gnrc_ipv6_fastfwd(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_fastfwd),
+        new_TestFixture(test_fastfwd__hop_limit_expires),
+        new_TestFixture(test_fastfwd__hop_by_hop),
+        new_TestFixture(test_fastfwd__next_hop_unresolved),
+        new_TestFixture(test_fastfwd__subscriber),
+    };
+
+    EMB_UNIT_TESTCALLER(fastfwd_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&fastfwd_tests;
+}
+
+int main(void)
+{
+    /* required to register the main thread as IPv6 subscriber */
+    msg_init_queue(_main_queue, ARRAY_SIZE(_main_queue));
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "mock_eth", &_netdev.netdev.netdev) == 0);
+    /* neighbor to forward to and a route over it */
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _netif.pid, _nbr_mac,
+                                sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst, DST_PFX_LEN, &_nbr_link_local,
+                                _netif.pid, 0) == 0);
+    /* a route over a neighbor whose link-layer address is unknown */
+    expect(gnrc_ipv6_nib_ft_add(&_dst2, DST_PFX_LEN, &_nbr2_link_local,
+                                _netif.pid, 0) == 0);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_ipv6_fastfwd());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the packet buffer unittests with gnrc_pktbuf_bins
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "tests-pktbuf.h"
+
+int main(void)
+{
+    TESTS_START();
+    tests_pktbuf();
+    return TESTS_END();
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the TCB lookup and the accept backlog of gnrc_tcp
+ *
+ * Clients and a listening queue on the same node talk over the loopback
+ * address, so several connections with the same addresses are spread over
+ * the hash buckets of the TCB list.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+
+#include "embUnit.h"
+#include "net/gnrc/tcp.h"
+#include "ztimer.h"
+
+#define SERVER_PORT     (2000U)
+#define CLIENT_PORT     (3000U)
+#define TCBS_NUMOF      (4U)
+#define ACCEPT_TIMEOUT  (100U)
+
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static gnrc_tcp_tcb_t _servers[TCBS_NUMOF];
+static gnrc_tcp_tcb_t _clients[TCBS_NUMOF];
+
+static int _connect(unsigned i)
+{
+    gnrc_tcp_ep_t remote;
+
+    gnrc_tcp_ep_from_str(&remote, "[::1]:2000");
+    gnrc_tcp_tcb_init(&_clients[i]);
+    return gnrc_tcp_open(&_clients[i], &remote, CLIENT_PORT + i);
+}
+
+/* returns the peer port of the accepted connection, 0 on error */
+static uint16_t _accept(gnrc_tcp_tcb_t **tcb, uint32_t timeout_ms)
+{
+    gnrc_tcp_ep_t remote;
+
+    if ((gnrc_tcp_accept(&_queue, tcb, timeout_ms) != 0) ||
+        (gnrc_tcp_get_remote(*tcb, &remote) != 0)) {
+        return 0;
+    }
+    return remote.port;
+}
+
+static void set_up(void)
+{
+    gnrc_tcp_ep_t local;
+
+    gnrc_tcp_ep_from_str(&local, "[::]:2000");
+    for (unsigned i = 0; i < TCBS_NUMOF; i++) {
+        gnrc_tcp_tcb_init(&_servers[i]);
+    }
+    gnrc_tcp_tcb_queue_init(&_queue);
+    gnrc_tcp_listen(&_queue, _servers, TCBS_NUMOF, &local);
+}
+
+static void tear_down(void)
+{
+    for (unsigned i = 0; i < TCBS_NUMOF; i++) {
+        gnrc_tcp_abort(&_clients[i]);
+    }
+    /* let the event loop process the resets */
+    ztimer_sleep(ZTIMER_MSEC, 10);
+    gnrc_tcp_stop_listen(&_queue);
+}
+
+static void test_backlog_order(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _connect(i));
+    }
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(CLIENT_PORT + i, _accept(&tcb, ACCEPT_TIMEOUT));
+    }
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, gnrc_tcp_accept(&_queue, &tcb, 0));
+}
+
+static void test_demux(void)
+{
+    gnrc_tcp_tcb_t *tcbs[TCBS_NUMOF];
+    uint8_t data;
+
+    for (unsigned i = 0; i < TCBS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _connect(i));
+    }
+    for (unsigned i = 0; i < TCBS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(CLIENT_PORT + i, _accept(&tcbs[i], ACCEPT_TIMEOUT));
+    }
+    /* every connection carries its own byte in both directions */
+    for (unsigned i = TCBS_NUMOF; i > 0; i--) {
+        data = i;
+        TEST_ASSERT_EQUAL_INT(1, gnrc_tcp_send(&_clients[i - 1], &data, 1, 0));
+    }
+    for (unsigned i = 0; i < TCBS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_tcp_recv(tcbs[i], &data, 1, ACCEPT_TIMEOUT));
+        TEST_ASSERT_EQUAL_INT(i + 1, data);
+        data = 0x80 | i;
+        TEST_ASSERT_EQUAL_INT(1, gnrc_tcp_send(tcbs[i], &data, 1, 0));
+    }
+    for (unsigned i = 0; i < TCBS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_tcp_recv(&_clients[i], &data, 1, ACCEPT_TIMEOUT));
+        TEST_ASSERT_EQUAL_INT(0x80 | i, data);
+    }
+}
+
+static void test_remove_on_reset(void)
+{
+    gnrc_tcp_tcb_t *tcb;
+
+    TEST_ASSERT_EQUAL_INT(0, _connect(0));
+    TEST_ASSERT_EQUAL_INT(0, _connect(1));
+    TEST_ASSERT_EQUAL_INT(0, _connect(2));
+    /* the reset reaches the server before the next handshake */
+    gnrc_tcp_abort(&_clients[1]);
+    TEST_ASSERT_EQUAL_INT(0, _connect(3));
+    TEST_ASSERT_EQUAL_INT(CLIENT_PORT, _accept(&tcb, ACCEPT_TIMEOUT));
+    TEST_ASSERT_EQUAL_INT(CLIENT_PORT + 2, _accept(&tcb, ACCEPT_TIMEOUT));
+    TEST_ASSERT_EQUAL_INT(CLIENT_PORT + 3, _accept(&tcb, ACCEPT_TIMEOUT));
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, gnrc_tcp_accept(&_queue, &tcb, 0));
+
+    /* the reset TCB listens again */
+    TEST_ASSERT_EQUAL_INT(0, _connect(1));
+    TEST_ASSERT_EQUAL_INT(CLIENT_PORT + 1, _accept(&tcb, ACCEPT_TIMEOUT));
+}
+
+static Test *tests_gnrc_tcp_tcb_lookup(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_backlog_order),
+        new_TestFixture(test_demux),
+        new_TestFixture(test_remove_on_reset),
+    };
+
+    EMB_UNIT_TESTCALLER(tcb_lookup_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tcb_lookup_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_tcp_tcb_lookup());
+    return TESTS_END();
+}
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "ztimer.h"
@@ -1142,6 +1143,59 @@ static void test_sock_udp_recv_buf6__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_batch6__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_batch_rx_t msgs[3] = {
+        { .data = &_test_buffer[0], .max_len = 16 },
+        { .data = &_test_buffer[16], .max_len = 16 },
+        { .data = &_test_buffer[32], .max_len = 16 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                           _TEST_NETIF));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "EFGHIJ", sizeof("EFGHIJ"),
+                           _TEST_NETIF));
+    expect(2 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(sizeof("EFGHIJ") == msgs[1].len);
+    expect(memcmp(msgs[1].data, "EFGHIJ", sizeof("EFGHIJ")) == 0);
+    for (unsigned i = 0; i < 2; i++) {
+        expect(AF_INET6 == msgs[i].remote.family);
+        expect(memcmp(&msgs[i].remote.addr, &src_addr,
+                      sizeof(src_addr)) == 0);
+        expect(_TEST_PORT_REMOTE == msgs[i].remote.port);
+    }
+    expect(-EAGAIN == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    /* a datagram too large for its buffer is truncated */
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "KLMNOPQRSTUVWXYZ",
+                           sizeof("KLMNOPQRSTUVWXYZ"), _TEST_NETIF));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                           _TEST_NETIF));
+    expect(2 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(16 == msgs[0].len);
+    expect(msgs[0].truncated);
+    expect(memcmp(msgs[0].data, "KLMNOPQRSTUVWXYZ", 16) == 0);
+    expect(sizeof("ABCD") == msgs[1].len);
+    expect(!msgs[1].truncated);
+    expect(memcmp(msgs[1].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(_check_net());
+}
+
 static void test_sock_udp_send6__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
@@ -1320,6 +1374,34 @@ static void test_sock_udp_sendv6__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_batch6__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR6_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    static const sock_udp_batch_tx_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFGHIJ", .len = sizeof("EFGHIJ"), .remote = &remote },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_batch(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_6packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_6packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EFGHIJ", sizeof("EFGHIJ"),
+                         _TEST_NETIF, false));
+    ztimer_sleep(ZTIMER_MSEC, 1);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send6__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_LOCAL };
@@ -1552,6 +1634,7 @@ int main(void)
     CALL(test_sock_udp_recv6__non_blocking());
     CALL(test_sock_udp_recv6__aux());
     CALL(test_sock_udp_recv_buf6__success());
+    CALL(test_sock_udp_recv_batch6__socketed());
     _prepare_send_checks();
     CALL(test_sock_udp_send6__EAFNOSUPPORT());
     CALL(test_sock_udp_send6__EINVAL_addr());
@@ -1564,6 +1647,7 @@ int main(void)
     CALL(test_sock_udp_send6__socketed_no_local());
     CALL(test_sock_udp_send6__socketed());
     CALL(test_sock_udp_sendv6__socketed());
+    CALL(test_sock_udp_send_batch6__socketed());
     CALL(test_sock_udp_send6__socketed_other_remote());
     CALL(test_sock_udp_send6__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send6__unsocketed_no_netif());
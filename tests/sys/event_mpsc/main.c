@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the lock-free multi-producer event queue
+ *
+ * A timer ISR and three threads post distinct events to one queue. The
+ * consumer has the highest priority and drains the queue after every wake
+ * up, while the ISR and the producer it wakes preempt the other producers
+ * at arbitrary points of event_mpsc_post(). Every event has to be handled
+ * exactly once.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event/mpsc.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define EVENTS_PER_SOURCE   (250U)
+/* the ISR, the producer woken by it and two busy producers */
+#define SOURCES_NUMOF       (4U)
+#define EVENTS_NUMOF        (SOURCES_NUMOF * EVENTS_PER_SOURCE)
+#define TIMER_PERIOD_US     (100U)
+/* time the busy producers spend between two posts */
+#define BUSY_US             (20U)
+#define THREAD_FLAG_POST    (0x1)
+#define THREAD_FLAG_DONE    (0x2)
+
+typedef struct {
+    event_t super;
+    unsigned idx;
+} test_event_t;
+
+static char _stack_consumer[THREAD_STACKSIZE_DEFAULT];
+static char _stacks[SOURCES_NUMOF - 1][THREAD_STACKSIZE_DEFAULT];
+
+static event_mpsc_queue_t _queue;
+static test_event_t _events[EVENTS_NUMOF];
+static uint8_t _handled[EVENTS_NUMOF];
+static unsigned _handled_numof;
+static thread_t *_main;
+static thread_t *_woken;
+static ztimer_t _timer;
+static unsigned _isr_posted;
+
+static void _handler(event_t *ev)
+{
+    _handled[container_of(ev, test_event_t, super)->idx]++;
+    if (++_handled_numof == EVENTS_NUMOF) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+}
+
+static void _post(unsigned source, unsigned i)
+{
+    event_mpsc_post(&_queue, &_events[source * EVENTS_PER_SOURCE + i].super);
+}
+
+static void _timer_cb(void *arg)
+{
+    (void)arg;
+
+    _post(0, _isr_posted);
+    thread_flags_set(_woken, THREAD_FLAG_POST);
+    if (++_isr_posted < EVENTS_PER_SOURCE) {
+        ztimer_set(ZTIMER_USEC, &_timer, TIMER_PERIOD_US);
+    }
+}
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+
+    event_mpsc_queue_init(&_queue);
+    event_mpsc_loop(&_queue);
+
+    return NULL;
+}
+
+/* posts one event whenever the timer ISR wakes it */
+static void *_woken_producer(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < EVENTS_PER_SOURCE; i++) {
+        thread_flags_wait_any(THREAD_FLAG_POST);
+        _post(1, i);
+    }
+
+    return NULL;
+}
+
+static void *_busy_producer(void *arg)
+{
+    unsigned source = (uintptr_t)arg;
+
+    for (unsigned i = 0; i < EVENTS_PER_SOURCE; i++) {
+        _post(source, i);
+        ztimer_spin(ZTIMER_USEC, BUSY_US);
+        thread_yield();
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i].super.handler = _handler;
+        _events[i].idx = i;
+    }
+
+    thread_create(_stack_consumer, sizeof(_stack_consumer),
+                  THREAD_PRIORITY_MAIN - 3, 0, _consumer, NULL, "consumer");
+    _woken = thread_get(thread_create(_stacks[0], sizeof(_stacks[0]),
+                                      THREAD_PRIORITY_MAIN - 2, 0,
+                                      _woken_producer, NULL, "woken"));
+    for (unsigned i = 1; i < SOURCES_NUMOF - 1; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD, _busy_producer,
+                      (void *)(uintptr_t)(i + 1), "busy");
+    }
+    _timer.callback = _timer_cb;
+    ztimer_set(ZTIMER_USEC, &_timer, TIMER_PERIOD_US);
+
+    thread_flags_wait_any(THREAD_FLAG_DONE);
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        if (_handled[i] != 1) {
+            printf("event %u handled %u times\n", i, _handled[i]);
+        }
+        expect(_handled[i] == 1);
+    }
+    /* nothing is handled late */
+    ztimer_sleep(ZTIMER_USEC, 10 * TIMER_PERIOD_US);
+    expect(_handled_numof == EVENTS_NUMOF);
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test sys/sched_cycles
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "ps.h"
+#include "sched_cycles.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define BUSY_US     (50U * US_PER_MS)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static sched_cycles_entry_t _snapshot[KERNEL_PID_LAST + 1];
+
+static void *_busy_thread(void *arg)
+{
+    (void)arg;
+
+    ztimer_spin(ZTIMER_USEC, BUSY_US);
+    thread_sleep();
+
+    return NULL;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    /* runs right away and blocks main for BUSY_US */
+    kernel_pid_t busy = thread_create(_stack, sizeof(_stack),
+                                      THREAD_PRIORITY_MAIN - 1, 0,
+                                      _busy_thread, NULL, "busy");
+
+    unsigned numof = sched_cycles_snapshot(_snapshot, ARRAY_SIZE(_snapshot));
+    uint64_t expected = (uint64_t)sched_cycles_freq() * BUSY_US / US_PER_SEC;
+    bool found_busy = false, found_main = false;
+
+    for (unsigned i = 0; i < numof; i++) {
+        if (_snapshot[i].pid == busy) {
+            found_busy = true;
+            printf("busy: %" PRIu32 " cycles, %" PRIu32 " switches\n",
+                   (uint32_t)_snapshot[i].cycles, _snapshot[i].switches);
+            ok &= (_snapshot[i].switches == 1);
+            ok &= (_snapshot[i].cycles >= expected);
+            ok &= (_snapshot[i].cycles < 2 * expected);
+        }
+        if (_snapshot[i].pid == thread_getpid()) {
+            found_main = true;
+            ok &= (_snapshot[i].switches >= 2);
+        }
+    }
+    ok &= found_busy && found_main;
+
+    ps();
+
+    puts(ok ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test sys/sched_edf
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "sched_edf.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define PERIODIC_PERIOD_US  (10U * US_PER_MS)
+#define PERIODIC_BUDGET_US  (4U * US_PER_MS)
+#define PERIODIC_WORK_US    (2U * US_PER_MS)
+#define HOG_PERIOD_US       (20U * US_PER_MS)
+#define HOG_BUDGET_US       (5U * US_PER_MS)
+#define TEST_DURATION_US    (500U * US_PER_MS)
+#define TEST_JOBS           (TEST_DURATION_US / PERIODIC_PERIOD_US)
+
+/* Budgets are accounted in wall-clock time. On native, the host may take the
+ * CPU away from the whole process, so a job of the periodic thread can
+ * exceed its budget or miss its deadline although the scheduler did
+ * everything right. Such jobs are excused, plus a few that were delayed
+ * without exceeding the budget. */
+#ifdef CPU_NATIVE
+#define HOST_CAN_STALL      (1)
+#define TOLERATED_MISSES    (TEST_JOBS / 10)
+#else
+#define HOST_CAN_STALL      (0)
+#define TOLERATED_MISSES    (0)
+#endif
+
+/* jobs of the periodic thread that took longer than its budget */
+static unsigned _stalled_jobs;
+
+static char _stack_periodic[THREAD_STACKSIZE_DEFAULT];
+static char _stack_hog[THREAD_STACKSIZE_DEFAULT];
+
+static void *_periodic_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        ztimer_spin(ZTIMER_USEC, PERIODIC_WORK_US);
+        if (HOST_CAN_STALL
+            && (ztimer_now(ZTIMER_USEC) - start > PERIODIC_BUDGET_US)) {
+            /* only the host can delay the highest priority thread this long */
+            _stalled_jobs++;
+        }
+        sched_edf_wait_period();
+    }
+
+    return NULL;
+}
+
+static void *_hog_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {}
+
+    return NULL;
+}
+
+static bool _print_stats(const char *name, kernel_pid_t pid)
+{
+    sched_edf_stats_t stats;
+
+    if (sched_edf_get_stats(pid, &stats) != 0) {
+        return false;
+    }
+    printf("%s: jobs %" PRIu32 " overruns %" PRIu32 " deadline misses %"
+           PRIu32 "\n", name, stats.jobs, stats.overruns,
+           stats.deadline_misses);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    /* lower priority than main, they only get to run as EDF threads */
+    kernel_pid_t periodic = thread_create(_stack_periodic,
+                                          sizeof(_stack_periodic),
+                                          THREAD_PRIORITY_MAIN + 1, 0,
+                                          _periodic_thread, NULL, "periodic");
+    kernel_pid_t hog = thread_create(_stack_hog, sizeof(_stack_hog),
+                                     THREAD_PRIORITY_MAIN + 1, 0,
+                                     _hog_thread, NULL, "hog");
+
+    puts("admission control");
+    ok &= (sched_edf_admit(periodic, PERIODIC_BUDGET_US, PERIODIC_PERIOD_US)
+           == -EINVAL);
+    ok &= (sched_edf_admit(periodic, PERIODIC_PERIOD_US, PERIODIC_BUDGET_US)
+           == 0);
+    ok &= (sched_edf_admit(periodic, PERIODIC_PERIOD_US, PERIODIC_BUDGET_US)
+           == -EALREADY);
+    /* 40% + 70% exceeds the limit */
+    ok &= (sched_edf_admit(hog, 10 * US_PER_MS, 7 * US_PER_MS) == -EBUSY);
+    ok &= (sched_edf_utilization() == 400);
+
+    puts("running periodic threads");
+    ok &= (sched_edf_admit(hog, HOG_PERIOD_US, HOG_BUDGET_US) == 0);
+    ok &= (sched_edf_utilization() == 650);
+
+    /* the hog is demoted once its budget is exhausted, so main can run */
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION_US);
+
+    ok &= _print_stats("periodic", periodic);
+    printf("periodic: jobs stalled by the host %u\n", _stalled_jobs);
+    ok &= _print_stats("hog", hog);
+    ok &= (sched_edf_overruns(periodic) <= _stalled_jobs + TOLERATED_MISSES);
+    ok &= (sched_edf_overruns(hog) > 0);
+
+    sched_edf_stats_t stats;
+
+    sched_edf_get_stats(periodic, &stats);
+    ok &= (stats.deadline_misses <= _stalled_jobs + TOLERATED_MISSES);
+    ok &= (stats.jobs + TOLERATED_MISSES >= TEST_JOBS);
+
+    ok &= (sched_edf_remove(hog) == 0);
+    ok &= (sched_edf_remove(hog) == -ENOENT);
+    ok &= (sched_edf_remove(periodic) == 0);
+    ok &= (sched_edf_utilization() == 0);
+
+    puts(ok ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
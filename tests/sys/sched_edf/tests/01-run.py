@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("admission control")
+    child.expect_exact("running periodic threads")
+    child.expect(r"periodic: jobs \d+ overruns \d+ deadline misses \d+")
+    child.expect(r"periodic: jobs stalled by the host \d+")
+    child.expect(r"hog: jobs \d+ overruns [1-9]\d* deadline misses \d+")
+    child.expect_exact("[SUCCESS]", timeout=10)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
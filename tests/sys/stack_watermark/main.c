@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test sys/stack_watermark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "stack_watermark.h"
+#include "thread.h"
+
+#define DEEP_USAGE      (1024U)
+/* words written at the deep end of the sparsely used buffer */
+#define SPARSE_WORDS    (16U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT + 2 * DEEP_USAGE];
+static kernel_pid_t _pid;
+static unsigned _reports;
+
+static void __attribute__((noinline)) _use_stack(void)
+{
+    volatile char buf[DEEP_USAGE];
+
+    memset((char *)buf, 0x55, sizeof(buf));
+}
+
+/* leaves a large untouched gap above the deepest used words */
+static void __attribute__((noinline)) _use_stack_sparse(void)
+{
+    volatile uintptr_t buf[2 * DEEP_USAGE / sizeof(uintptr_t)];
+
+    for (unsigned i = 0; i < SPARSE_WORDS; i++) {
+        buf[i] = i;
+    }
+    (void)buf;
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    thread_sleep();
+    _use_stack();
+    while (1) {
+        thread_sleep();
+        _use_stack_sparse();
+    }
+
+    return NULL;
+}
+
+static void _report_cb(kernel_pid_t pid, size_t headroom, void *arg)
+{
+    (void)headroom;
+    (void)arg;
+
+    if (pid == _pid) {
+        _reports++;
+    }
+}
+
+/* runs rounds until the stacks of all threads are painted and scanned */
+static void _update(void)
+{
+    for (unsigned i = 0; i < 2 * sizeof(_stack) / sizeof(uintptr_t); i++) {
+        stack_watermark_step(CONFIG_STACK_WATERMARK_STEP_WORDS);
+    }
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    stack_watermark_set_cb(_report_cb, NULL);
+    _pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                         _thread, NULL, "deep");
+    _update();
+
+    thread_t *thread = thread_get(_pid);
+    size_t before = stack_watermark_headroom(_pid);
+    size_t measured = thread_measure_stack_free(thread);
+
+    printf("before: headroom %u, measured %u\n", (unsigned)before,
+           (unsigned)measured);
+    /* the stack is painted now, except for the red zone below the SP */
+    ok &= (before >= measured);
+    ok &= (before - measured <= CONFIG_STACK_WATERMARK_REDZONE);
+    ok &= (before > DEEP_USAGE);
+
+    thread_wakeup(_pid);
+    _update();
+
+    size_t after = stack_watermark_headroom(_pid);
+
+    measured = thread_measure_stack_free(thread);
+    printf("after: headroom %u, measured %u\n", (unsigned)after,
+           (unsigned)measured);
+    ok &= (after >= measured);
+    ok &= (after - measured <= CONFIG_STACK_WATERMARK_REDZONE);
+    /* the buffer may partially overlap the red zone of the first sample */
+    ok &= (after + DEEP_USAGE <= before + CONFIG_STACK_WATERMARK_REDZONE);
+
+    thread_wakeup(_pid);
+    _update();
+
+    size_t sparse = stack_watermark_headroom(_pid);
+
+    measured = thread_measure_stack_free(thread);
+    printf("sparse: headroom %u, measured %u\n", (unsigned)sparse,
+           (unsigned)measured);
+    ok &= (sparse >= measured);
+    ok &= (sparse - measured <= CONFIG_STACK_WATERMARK_REDZONE);
+    /* the untouched upper part of the buffer must not hide its deep end */
+    ok &= (sparse + DEEP_USAGE <= after + CONFIG_STACK_WATERMARK_REDZONE);
+
+    printf("reports: %u\n", _reports);
+    ok &= (_reports > 0);
+
+    puts(ok ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
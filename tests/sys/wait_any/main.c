@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test sys/wait_any
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "mbox.h"
+#include "msg.h"
+#include "sema.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "wait_any.h"
+
+#define FLAG_TEST       (0x2)
+
+enum {
+    SRC_FLAGS,
+    SRC_EVENT,
+    SRC_SEMA,
+    SRC_MBOX,
+    SRC_MSG,
+    SRC_NUMOF,
+};
+
+static const char *_names[] = { "flags", "event", "sema", "mbox", "msg" };
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[4];
+static msg_t _mbox_queue[4];
+static mbox_t _mbox;
+static sema_t _sema;
+static event_queue_t _queue;
+static event_t _event;
+static thread_t *_main;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+}
+
+/* runs at lower priority, so the main thread handles each source before
+ * the next one is triggered */
+static void *_thread(void *arg)
+{
+    (void)arg;
+    msg_t msg = { .type = SRC_MSG };
+
+    msg_send(&msg, _main->pid);
+    msg.type = SRC_MBOX;
+    mbox_put(&_mbox, &msg);
+    sema_post(&_sema);
+    event_post(&_queue, &_event);
+    thread_flags_set(_main, FLAG_TEST);
+
+    return NULL;
+}
+
+/* fetches from the ready source, returns false if nothing was there */
+static bool _fetch(size_t src)
+{
+    msg_t msg;
+
+    switch (src) {
+    case SRC_FLAGS:
+        return thread_flags_clear(FLAG_TEST) == FLAG_TEST;
+    case SRC_EVENT:
+        return event_get(&_queue) == &_event;
+    case SRC_SEMA:
+        return sema_try_wait(&_sema) == 0;
+    case SRC_MBOX:
+        return mbox_try_get(&_mbox, &msg) && (msg.type == SRC_MBOX);
+    case SRC_MSG:
+        return (msg_try_receive(&msg) == 1) && (msg.type == SRC_MSG);
+    }
+
+    return false;
+}
+
+int main(void)
+{
+    const wait_any_src_t srcs[SRC_NUMOF] = {
+        [SRC_FLAGS] = WAIT_ANY_SRC_FLAGS(FLAG_TEST),
+        [SRC_EVENT] = WAIT_ANY_SRC_EVENT(&_queue),
+        [SRC_SEMA] = WAIT_ANY_SRC_SEMA(&_sema),
+        [SRC_MBOX] = WAIT_ANY_SRC_MBOX(&_mbox),
+        [SRC_MSG] = WAIT_ANY_SRC_MSG(),
+    };
+    bool ok = true;
+
+    _main = thread_get_active();
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    mbox_init(&_mbox, _mbox_queue, ARRAY_SIZE(_mbox_queue));
+    sema_create(&_sema, 0);
+    event_queue_init(&_queue);
+    _event.handler = _handler;
+
+    /* sources that are ready on entry are returned in order */
+    sema_post(&_sema);
+    event_post(&_queue, &_event);
+    size_t src = wait_any(srcs, SRC_NUMOF);
+    printf("ready on entry: %s\n", _names[src]);
+    ok &= (src == SRC_EVENT) && _fetch(src);
+    src = wait_any(srcs, SRC_NUMOF);
+    printf("ready on entry: %s\n", _names[src]);
+    ok &= (src == SRC_SEMA) && _fetch(src);
+
+    /* the other thread makes the sources ready one after the other */
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1, 0,
+                  _thread, NULL, "trigger");
+    for (int expected = SRC_MSG; expected >= SRC_FLAGS; expected--) {
+        src = wait_any(srcs, SRC_NUMOF);
+        printf("woken by: %s\n", _names[src]);
+        ok &= (src == (size_t)expected) && _fetch(src);
+    }
+
+    /* notifications were consumed, no source is registered anymore */
+    ok &= (_mbox.notify == NULL) && (_sema.waiter == NULL);
+
+    puts(ok ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
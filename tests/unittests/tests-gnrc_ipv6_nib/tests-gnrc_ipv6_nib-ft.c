@@ -178,6 +178,52 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds three nested routes, shortest prefix first, and removes some of them
+ * again.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the remaining route
+ * with the longest matching prefix
+ */
+static void test_nib_ft_get__success5(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+    static const ipv6_addr_t next_hop3 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 2 } } };
+    ipv6_addr_t other = dst;
+
+    /* only in the shortest prefix */
+    bf_toggle(other.u8, GLOBAL_PREFIX_LEN - 1);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN - 1,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 64,
+                                                  &next_hop3, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop3, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&other, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN - 1, fte.dst_len);
+
+    gnrc_ipv6_nib_ft_del(&dst, 64);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN - 1);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&other, NULL,
+                                                             &fte));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +773,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
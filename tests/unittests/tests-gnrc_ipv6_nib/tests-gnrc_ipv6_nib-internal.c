@@ -361,6 +361,101 @@ static void test_nib_get__empty(void)
     TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
 }
 
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0
+#define HASH_LAST_SLOT      (CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF - 1)
+#define HASH_WRAP_NUMOF     (4)     /* entries with home slot HASH_LAST_SLOT */
+#define HASH_CHAIN_NUMOF    (HASH_WRAP_NUMOF + 2)
+
+/*
+ * Finds addresses that collide in the on-link hash index and adds them as
+ * neighbor cache entries: the first HASH_WRAP_NUMOF have their home slot at the
+ * end of the table, so their probe sequence wraps around to slot 0, the rest
+ * have their home slot at slot 0 and are displaced behind them.
+ */
+static void _onl_hash_chain(ipv6_addr_t *addrs, _nib_onl_entry_t **nodes)
+{
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < HASH_CHAIN_NUMOF; i++) {
+        unsigned slot = (i < HASH_WRAP_NUMOF) ? HASH_LAST_SLOT : 0;
+
+        while (_nib_onl_hash_slot(&addr) != slot) {
+            addr.u64[1].u64++;
+        }
+        addrs[i] = addr;
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+}
+
+/*
+ * Builds a probe chain that wraps around the end of the hash index and
+ * removes the entries in the given order.
+ * Expected result: after each removal, the removed entries are not found,
+ * all other entries still are
+ */
+static void _test_nib_onl_hash_del(const unsigned *order, unsigned num)
+{
+    ipv6_addr_t addrs[HASH_CHAIN_NUMOF];
+    _nib_onl_entry_t *nodes[HASH_CHAIN_NUMOF];
+
+    _onl_hash_chain(addrs, nodes);
+    for (unsigned i = 0; i < num; i++) {
+        nodes[order[i]]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[order[i]]));
+        nodes[order[i]] = NULL;
+        for (unsigned j = 0; j < HASH_CHAIN_NUMOF; j++) {
+            TEST_ASSERT(nodes[j] == _nib_onl_get(&addrs[j], IFACE));
+        }
+    }
+}
+
+/*
+ * Removes the first entry of the probe chain, which is in the last slot of
+ * the hash index, so the entries behind it are moved back across the end of
+ * the table.
+ */
+static void test_nib_onl_hash_del__wrapped_head(void)
+{
+    static const unsigned order[] = { 0 };
+
+    _test_nib_onl_hash_del(order, ARRAY_SIZE(order));
+}
+
+/*
+ * Removes an entry from the middle of the probe chain, after the wrap-around.
+ */
+static void test_nib_onl_hash_del__middle(void)
+{
+    static const unsigned order[] = { 2 };
+
+    _test_nib_onl_hash_del(order, ARRAY_SIZE(order));
+}
+
+/*
+ * Removes an entry that was displaced from its home slot by a collision with
+ * entries of another home slot.
+ */
+static void test_nib_onl_hash_del__displaced(void)
+{
+    static const unsigned order[] = { HASH_WRAP_NUMOF };
+
+    _test_nib_onl_hash_del(order, ARRAY_SIZE(order));
+}
+
+/*
+ * Removes all entries of the probe chain in mixed order.
+ */
+static void test_nib_onl_hash_del__all(void)
+{
+    static const unsigned order[] = { 2, 0, 4, 1, 5, 3 };
+
+    _test_nib_onl_hash_del(order, ARRAY_SIZE(order));
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0 */
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
  * addresses and a non-garbage-collectible AR state and then tries to add
@@ -2072,6 +2167,12 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_iter__three_elem),
         new_TestFixture(test_nib_iter__three_elem_middle_removed),
         new_TestFixture(test_nib_get__empty),
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_NUMOF > 0
+        new_TestFixture(test_nib_onl_hash_del__wrapped_head),
+        new_TestFixture(test_nib_onl_hash_del__middle),
+        new_TestFixture(test_nib_onl_hash_del__displaced),
+        new_TestFixture(test_nib_onl_hash_del__all),
+#endif
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
@@ -304,6 +304,34 @@ static void test_nib_nc_mark_reachable__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
 }
 
+/*
+ * Creates an unreachable neighbor cache entry and marks it as reachable twice,
+ * then iterates the neighbor cache.
+ * Expected result: only the first gnrc_ipv6_nib_nc_mark_reachable() advances
+ * the generation of the NIB
+ */
+static void test_nib_nc_mark_reachable__gen(void)
+{
+    void *iter_state = NULL;
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                             { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t gen;
+
+    TEST_ASSERT_NOT_NULL(_nib_nc_add(&addr, IFACE,
+                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE));
+    gen = gnrc_ipv6_nib_gen();
+    gnrc_ipv6_nib_nc_mark_reachable(&addr);
+    TEST_ASSERT(gen != gnrc_ipv6_nib_gen());
+    gen = gnrc_ipv6_nib_gen();
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    /* entry is reachable now */
+    gnrc_ipv6_nib_nc_mark_reachable(&addr);
+#endif
+    TEST_ASSERT(gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_nib_gen());
+}
+
 Test *tests_gnrc_ipv6_nib_nc_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -317,6 +345,7 @@ Test *tests_gnrc_ipv6_nib_nc_tests(void)
         new_TestFixture(test_nib_nc_mark_reachable__not_in_neighbor_cache),
         new_TestFixture(test_nib_nc_mark_reachable__unmanaged),
         new_TestFixture(test_nib_nc_mark_reachable__success),
+        new_TestFixture(test_nib_nc_mark_reachable__gen),
         /* gnrc_ipv6_nib_nc_iter() is tested during all the tests above */
     };
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include "container.h"
+#include "embUnit.h"
+#include "mbox.h"
+#include "msg.h"
+#include "thread.h"
+
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pktbuf.h"
+
+#include "unittests-constants.h"
+#include "tests-gnrc_netapi_train.h"
+
+#define TEST_TRAIN_LEN  (3U)
+#define TEST_QUEUE_SIZE (8U)
+
+static msg_t _msg_queue[TEST_QUEUE_SIZE];
+static msg_t _mbox_queue[TEST_QUEUE_SIZE];
+static mbox_t _mbox = MBOX_INIT(_mbox_queue, ARRAY_SIZE(_mbox_queue));
+static gnrc_netreg_entry_t _train_entry;
+static gnrc_netreg_entry_t _mbox_entry;
+static gnrc_pktsnip_t *_pkts[TEST_TRAIN_LEN];
+static gnrc_pktsnip_t *_train;
+
+static void set_up(void)
+{
+    if (!thread_has_msg_queue(thread_get_active())) {
+        msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    }
+    gnrc_pktbuf_init();
+    gnrc_netreg_init();
+    gnrc_netreg_entry_init_train(&_train_entry, TEST_UINT16, thread_getpid());
+    gnrc_netreg_entry_init_mbox(&_mbox_entry, TEST_UINT16, &_mbox);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        _pkts[i] = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                                   GNRC_NETTYPE_TEST);
+    }
+    _train = gnrc_netapi_train_build(_pkts, ARRAY_SIZE(_pkts));
+}
+
+
+/* receives the train the train subscriber got and releases it */
+static void _recv_train(gnrc_pktsnip_t *train, uint16_t type)
+{
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(type, msg.type);
+    TEST_ASSERT(msg.content.ptr == train);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_pkts), gnrc_netapi_train_len(train));
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        gnrc_pktsnip_t *pkt = gnrc_netapi_train_get(train, i);
+
+        TEST_ASSERT(pkt == _pkts[i]);
+        gnrc_pktbuf_release(pkt);
+    }
+    gnrc_pktbuf_release(train);
+    TEST_ASSERT_EQUAL_INT(-1, msg_try_receive(&msg));
+}
+
+/* receives the single packets the mbox subscriber got and releases them */
+static void _recv_mbox(uint16_t type)
+{
+    msg_t msg;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(1, mbox_try_get(&_mbox, &msg));
+        TEST_ASSERT_EQUAL_INT(type, msg.type);
+        TEST_ASSERT(msg.content.ptr == _pkts[i]);
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&_mbox, &msg));
+}
+
+static void test_netapi_dispatch_train__no_subscriber(void)
+{
+    TEST_ASSERT_NOT_NULL(_train);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_dispatch_train(
+                                GNRC_NETTYPE_TEST, TEST_UINT16, _train));
+    /* caller keeps all references */
+    TEST_ASSERT_EQUAL_INT(1, _train->users);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(1, _pkts[i]->users);
+        gnrc_pktbuf_release(_pkts[i]);
+    }
+    gnrc_pktbuf_release(_train);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_train__train_subscriber(void)
+{
+    TEST_ASSERT_NOT_NULL(_train);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                  &_train_entry));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_train(
+                                GNRC_NETTYPE_TEST, TEST_UINT16, _train));
+    TEST_ASSERT_EQUAL_INT(1, _train->users);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(1, _pkts[i]->users);
+    }
+    _recv_train(_train, GNRC_NETAPI_MSG_TYPE_SND_TRAIN);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_train__single_subscriber(void)
+{
+    TEST_ASSERT_NOT_NULL(_train);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                  &_mbox_entry));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_train(
+                                GNRC_NETTYPE_TEST, TEST_UINT16, _train));
+    /* the _train itself was released, the subscriber owns the packets */
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(1, _pkts[i]->users);
+    }
+    _recv_mbox(GNRC_NETAPI_MSG_TYPE_SND);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_train__mixed_subscribers(void)
+{
+    TEST_ASSERT_NOT_NULL(_train);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                  &_train_entry));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                  &_mbox_entry));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netapi_dispatch_train(
+                                GNRC_NETTYPE_TEST, TEST_UINT16, _train));
+    /* one reference to the _train for the _train subscriber, one reference to
+     * each packet for each subscriber */
+    TEST_ASSERT_EQUAL_INT(1, _train->users);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(2, _pkts[i]->users);
+    }
+    _recv_mbox(GNRC_NETAPI_MSG_TYPE_SND);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(1, _pkts[i]->users);
+    }
+    _recv_train(_train, GNRC_NETAPI_MSG_TYPE_SND_TRAIN);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netapi_dispatch_train__other_demux_ctx(void)
+{
+    TEST_ASSERT_NOT_NULL(_train);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                  &_train_entry));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_dispatch_train(
+                                GNRC_NETTYPE_TEST, TEST_UINT16 + 1, _train));
+    TEST_ASSERT_EQUAL_INT(1, _train->users);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pkts); i++) {
+        TEST_ASSERT_EQUAL_INT(1, _pkts[i]->users);
+        gnrc_pktbuf_release(_pkts[i]);
+    }
+    gnrc_pktbuf_release(_train);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+Test *tests_gnrc_netapi_train_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netapi_dispatch_train__no_subscriber),
+        new_TestFixture(test_netapi_dispatch_train__train_subscriber),
+        new_TestFixture(test_netapi_dispatch_train__single_subscriber),
+        new_TestFixture(test_netapi_dispatch_train__mixed_subscribers),
+        new_TestFixture(test_netapi_dispatch_train__other_demux_ctx),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_netapi_train_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_netapi_train_tests;
+}
+
+void tests_gnrc_netapi_train(void)
+{
+    TESTS_RUN(tests_gnrc_netapi_train_tests());
+}
+/** @} */
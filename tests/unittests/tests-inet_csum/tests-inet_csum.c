@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,71 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* byte-wise reference for the optimized implementation */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        csum += ((accum_len + i) & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _fill(uint8_t *buf, size_t len, unsigned seed)
+{
+    for (unsigned i = 0; i < len; i++) {
+        buf[i] = (seed) ? ((i * seed) ^ (i >> 3)) : 0xff;
+    }
+}
+
+static void test_inet_csum__alignments(void)
+{
+    /* covers all alignments of start and end, and the carries of a buffer
+     * full of 0xff */
+    static uint8_t data[96 + 8];
+
+    for (unsigned seed = 0; seed < 2; seed++) {
+        _fill(data, sizeof(data), seed * 167);
+        for (unsigned offset = 0; offset < 8; offset++) {
+            for (unsigned len = 0; len <= 96; len++) {
+                for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                    TEST_ASSERT_EQUAL_INT(
+                        _ref_csum_slice(0x1234, &data[offset], len, accum_len),
+                        inet_csum_slice(0x1234, &data[offset], len, accum_len));
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__copy(void)
+{
+    static uint8_t src[96 + 8];
+    static uint8_t dst[96 + 8];
+
+    _fill(src, sizeof(src), 167);
+    for (unsigned src_offset = 0; src_offset < 4; src_offset++) {
+        for (unsigned dst_offset = 0; dst_offset < 4; dst_offset++) {
+            for (unsigned len = 0; len <= 96; len += 3) {
+                memset(dst, 0, sizeof(dst));
+                TEST_ASSERT_EQUAL_INT(
+                    inet_csum_slice(0, &src[src_offset], len, src_offset),
+                    inet_csum_copy_slice(0, &dst[dst_offset], &src[src_offset],
+                                         len, src_offset));
+                TEST_ASSERT_EQUAL_INT(0, memcmp(&dst[dst_offset],
+                                                &src[src_offset], len));
+                /* nothing written behind dst */
+                TEST_ASSERT_EQUAL_INT(0, dst[dst_offset + len]);
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +242,8 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignments),
+        new_TestFixture(test_inet_csum__copy),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 
+#include "container.h"
 #include "embUnit.h"
 
 #include "net/gnrc/netreg.h"
@@ -185,6 +186,48 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_getnext__many_ctx(void)
+{
+    gnrc_netreg_entry_t ctx_entries[8];
+    gnrc_netreg_entry_t *res = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx_entries); i++) {
+        /* two entries for every demux context */
+        gnrc_netreg_entry_init_pid(&ctx_entries[i], TEST_UINT16 + (i / 2),
+                                   TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &ctx_entries[i]));
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx_entries) / 2; i++) {
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                                 TEST_UINT16 + i));
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       TEST_UINT16 + i)));
+        TEST_ASSERT_EQUAL_INT(TEST_UINT16 + i, res->demux_ctx);
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+        TEST_ASSERT_EQUAL_INT(TEST_UINT16 + i, res->demux_ctx);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                        GNRC_NETREG_DEMUX_CTX_ALL));
+    gnrc_netreg_release_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx_entries); i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &ctx_entries[i]);
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx_entries) / 2; i++) {
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       TEST_UINT16 + i)));
+        TEST_ASSERT(res == &ctx_entries[(i * 2) + 1]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    gnrc_netreg_release_shared();
+    for (unsigned i = 1; i < ARRAY_SIZE(ctx_entries); i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &ctx_entries[i]);
+    }
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +244,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__many_ctx),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
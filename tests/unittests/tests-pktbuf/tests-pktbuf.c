@@ -21,6 +21,7 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/pktbuf.h"
+#include "thread.h"
 
 #include "unittests-constants.h"
 #include "tests-pktbuf.h"
@@ -205,6 +206,7 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+#ifndef MODULE_GNRC_PKTBUF_BINS     /* only few blocks fit packets of that size */
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -228,6 +230,89 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#else
+static void test_pktbuf_add__success(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    /* all MTU sized blocks can be used at once, descriptors come from the
+     * small blocks */
+    for (int i = 0; i < CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF; i++) {
+        gnrc_pktsnip_t *pkt_prev = pkt;
+
+        pkt = gnrc_pktbuf_add(pkt_prev, NULL, CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE,
+                              GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT(pkt->next == pkt_prev);
+        TEST_ASSERT_NOT_NULL(pkt->data);
+        TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE, pkt->size);
+        if (pkt_prev != NULL) {
+            TEST_ASSERT(pkt_prev->data < pkt->data);
+        }
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add__fallback(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    /* frame sized allocations use MTU sized blocks once the frame sized ones
+     * are exhausted */
+    for (int i = 0; i < CONFIG_GNRC_PKTBUF_BINS_FRAME_NUMOF +
+                        CONFIG_GNRC_PKTBUF_BINS_MTU_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE,
+                              GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add__too_large(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
+#ifdef MODULE_GNRC_PKTBUF_CACHE
+static char _cache_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_cache_thread(void *arg)
+{
+    (void)arg;
+
+    /* leaves frame sized blocks in the cache of this thread */
+    for (int i = 0; i < CONFIG_GNRC_PKTBUF_CACHE_NUMOF + 1; i++) {
+        gnrc_pktbuf_release(gnrc_pktbuf_add(NULL, NULL,
+                                            CONFIG_GNRC_PKTBUF_BINS_FRAME_SIZE,
+                                            GNRC_NETTYPE_TEST));
+    }
+    return NULL;
+}
+
+static void test_pktbuf_add__cache_thread_exit(void)
+{
+    /* more threads than caches, all of them exit with a filled cache */
+    for (int i = 0; i < CONFIG_GNRC_PKTBUF_CACHE_NUMOF + 1; i++) {
+        thread_create(_cache_stack, sizeof(_cache_stack),
+                      THREAD_PRIORITY_MAIN - 1, 0, _cache_thread, NULL,
+                      "pktbuf");
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    /* the blocks left in the caches are not lost */
+    test_pktbuf_add__fallback();
+}
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -249,7 +334,7 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_BINS) /* no holes to fill */
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, ALIGNMENT_SIZE, GNRC_NETTYPE_TEST);
@@ -661,7 +746,7 @@ static void test_pktbuf_realloc_data__success3(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_BINS) /* larger than any block */
 static void test_pktbuf_merge_data__memfull(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, (CONFIG_GNRC_PKTBUF_SIZE / 4),
@@ -673,7 +758,22 @@ static void test_pktbuf_merge_data__memfull(void)
     gnrc_pktbuf_release(pkt);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#elif defined(MODULE_GNRC_PKTBUF_BINS)
+static void test_pktbuf_merge_data__memfull(void)
+{
+    /* the merged data does not fit into the largest block */
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE / 2,
+                                          GNRC_NETTYPE_TEST);
+
+    pkt = gnrc_pktbuf_add(pkt, NULL, (CONFIG_GNRC_PKTBUF_BINS_MTU_SIZE / 2) + 1,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_merge(pkt));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
 
 static void test_pktbuf_merge_data__success1(void)
 {
@@ -821,7 +921,7 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_BINS) /* larger than any block */
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -843,7 +943,28 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#elif defined(MODULE_GNRC_PKTBUF_BINS)
+static void test_pktbuf_reverse_snips__too_full(void)
+{
+    gnrc_pktsnip_t *pkt, *pkt_next, *pkt_fill = NULL, *tmp;
+
+    pkt_next = gnrc_pktbuf_add(NULL, TEST_STRING16, ALIGNMENT_SIZE, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt_next);
+    /* hold to enforce duplication */
+    gnrc_pktbuf_hold(pkt_next, 1);
+    pkt = gnrc_pktbuf_add(pkt_next, TEST_STRING16, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* filling up all blocks */
+    while ((tmp = gnrc_pktbuf_add(pkt_fill, NULL, 1, GNRC_NETTYPE_UNDEF))) {
+        pkt_fill = tmp;
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_reverse_snips(pkt));
+    gnrc_pktbuf_release(pkt_fill);
+    /* release because of hold above */
+    gnrc_pktbuf_release(pkt_next);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -860,6 +981,23 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_free_bytes(void)
+{
+    gnrc_pktsnip_t *pkt;
+    size_t empty = gnrc_pktbuf_free_bytes();
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, 16, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+#ifdef MODULE_GNRC_PKTBUF_MALLOC
+    TEST_ASSERT(gnrc_pktbuf_free_bytes() == SIZE_MAX);
+#else
+    TEST_ASSERT(gnrc_pktbuf_free_bytes() <= (empty - 16));
+#endif
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_free_bytes() == empty);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -875,8 +1013,15 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
         new_TestFixture(test_pktbuf_add__success),
+#ifdef MODULE_GNRC_PKTBUF_BINS
+        new_TestFixture(test_pktbuf_add__fallback),
+        new_TestFixture(test_pktbuf_add__too_large),
+#endif
+#ifdef MODULE_GNRC_PKTBUF_CACHE
+        new_TestFixture(test_pktbuf_add__cache_thread_exit),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_BINS)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -902,7 +1047,7 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_realloc_data__success3),
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_merge_data__memfull),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_merge_data__success1),
         new_TestFixture(test_pktbuf_merge_data__success2),
         new_TestFixture(test_pktbuf_hold__pkt_null),
@@ -916,8 +1061,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
+        new_TestFixture(test_pktbuf_free_bytes),
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "spsc_rb.h"
+#include "tests-spsc_rb.h"
+
+#define TEST_INPUT          (0xdb)
+#define BUFFER_SIZE         (16)
+#define IO_BUFFER_CANARY    (0xb8)
+
+static uint8_t _rb_buffer[BUFFER_SIZE];
+static uint8_t _io_buffer[BUFFER_SIZE * 2];
+static spsc_rb_t _rb = SPSC_RB_INIT(_rb_buffer);
+
+static void set_up(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+}
+
+static void tear_down(void)
+{
+    memset(_rb_buffer, 0, sizeof(_rb_buffer));
+    spsc_rb_init(&_rb, _rb_buffer, BUFFER_SIZE);
+}
+
+/* moves the read and write positions to the middle of the buffer */
+static void _offset(void)
+{
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2,
+                          spsc_rb_add(&_rb, _io_buffer, BUFFER_SIZE / 2));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, spsc_rb_drop(&_rb, BUFFER_SIZE));
+}
+
+static void test_one(void)
+{
+    TEST_ASSERT(spsc_rb_empty(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spsc_rb_get_one(&_rb));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spsc_rb_add_one(&_rb, TEST_INPUT + i));
+        TEST_ASSERT_EQUAL_INT(i + 1, spsc_rb_avail(&_rb));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, spsc_rb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(0, spsc_rb_free(&_rb));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i),
+                              spsc_rb_get_one(&_rb));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, spsc_rb_get_one(&_rb));
+}
+
+static void test_add_get_wrap(void)
+{
+    _offset();
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          spsc_rb_add(&_rb, _io_buffer, sizeof(_io_buffer)));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(4, spsc_rb_peek(&_rb, _io_buffer, 4));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spsc_rb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          spsc_rb_get(&_rb, _io_buffer, sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+    TEST_ASSERT(spsc_rb_empty(&_rb));
+}
+
+static void test_reserve_commit(void)
+{
+    size_t len;
+    uint8_t *region;
+
+    _offset();
+    /* the free space is split at the end of the buffer */
+    region = spsc_rb_reserve(&_rb, &len);
+    TEST_ASSERT(region == &_rb_buffer[BUFFER_SIZE / 2]);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, len);
+    memset(region, TEST_INPUT, len);
+    spsc_rb_commit(&_rb, len);
+
+    region = spsc_rb_reserve(&_rb, &len);
+    TEST_ASSERT(region == _rb_buffer);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, len);
+    spsc_rb_commit(&_rb, 1);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2 + 1, spsc_rb_avail(&_rb));
+
+    spsc_rb_commit(&_rb, BUFFER_SIZE / 2 - 1);
+    TEST_ASSERT_NULL(spsc_rb_reserve(&_rb, &len));
+    TEST_ASSERT_EQUAL_INT(0, len);
+}
+
+static void test_peek_region_consume(void)
+{
+    size_t len;
+    const uint8_t *region;
+
+    TEST_ASSERT_NULL(spsc_rb_peek_region(&_rb, &len));
+    _offset();
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          spsc_rb_add(&_rb, _io_buffer, BUFFER_SIZE));
+
+    region = spsc_rb_peek_region(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, len);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, region[0]);
+    spsc_rb_consume(&_rb, len);
+
+    region = spsc_rb_peek_region(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, len);
+    TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE / 2), region[0]);
+
+    /* consuming after a clear has no effect */
+    spsc_rb_clear(&_rb);
+    spsc_rb_consume(&_rb, len);
+    TEST_ASSERT(spsc_rb_empty(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spsc_rb_free(&_rb));
+}
+
+static void test_pkt(void)
+{
+    uint8_t out[BUFFER_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, spsc_rb_get_pkt(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(-EMSGSIZE, spsc_rb_add_pkt(&_rb, _io_buffer,
+                                                     BUFFER_SIZE - 1));
+
+    _offset();
+    TEST_ASSERT_EQUAL_INT(0, spsc_rb_add_pkt(&_rb, _io_buffer, 5));
+    TEST_ASSERT_EQUAL_INT(0, spsc_rb_add_pkt(&_rb, _io_buffer + 5, 0));
+    TEST_ASSERT_EQUAL_INT(0, spsc_rb_add_pkt(&_rb, _io_buffer + 5, 4));
+    /* 7 + 2 + 6 bytes used */
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, spsc_rb_add_pkt(&_rb, _io_buffer, 0));
+
+    TEST_ASSERT_EQUAL_INT(-EMSGSIZE, spsc_rb_get_pkt(&_rb, out, 4));
+    TEST_ASSERT_EQUAL_INT(5, spsc_rb_get_pkt(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, _io_buffer, 5));
+    /* this header wraps around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(0, spsc_rb_get_pkt(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(4, spsc_rb_get_pkt(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, _io_buffer + 5, 4));
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, spsc_rb_get_pkt(&_rb, out, sizeof(out)));
+}
+
+static Test *tests_spsc_rb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_one),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_reserve_commit),
+        new_TestFixture(test_peek_region_consume),
+        new_TestFixture(test_pkt),
+    };
+
+    EMB_UNIT_TESTCALLER(spsc_rb_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&spsc_rb_tests;
+}
+
+void tests_spsc_rb(void)
+{
+    TESTS_RUN(tests_spsc_rb_tests());
+}
+/** @} */
@@ -213,6 +213,27 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move the read and write positions to the middle of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, tsrb_add(&_tsrb, _io_buffer,
+                                                    BUFFER_SIZE / 2));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, tsrb_drop(&_tsrb, BUFFER_SIZE));
+    /* both copies are split at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +249,7 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);